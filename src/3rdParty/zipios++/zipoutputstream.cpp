@@ -63,6 +63,12 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
   putNextEntry( ZipCDirEntry(entryName));
 }
 
+void ZipOutputStream::putRawEntry( const std::string &entryName, const char *data,
+				   uint32 data_size, StorageMethod method,
+				   uint32 size, uint32 crc ) {
+  ozf->putRawEntry( ZipCDirEntry( entryName ), data, data_size, method, size, crc ) ;
+}
+
 
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
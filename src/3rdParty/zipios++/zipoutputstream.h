@@ -54,6 +54,11 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Writes an entry with data that has already been compressed.
+      @see ZipOutputStreambuf::putRawEntry() */
+  void putRawEntry( const std::string &entryName, const char *data, uint32 data_size,
+		    StorageMethod method, uint32 size, uint32 crc ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
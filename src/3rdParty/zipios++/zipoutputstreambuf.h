@@ -49,6 +49,18 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry with data that has already been compressed, e.g.
+      on another thread. Any open entry is closed first and the data is
+      written as is.
+      @param entry the entry to write.
+      @param data the stored or deflated data of the entry.
+      @param data_size the number of bytes of data.
+      @param method the method used to produce data, STORED or DEFLATED.
+      @param size the size of the uncompressed data.
+      @param crc the crc32 of the uncompressed data. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 data_size,
+		    StorageMethod method, uint32 size, uint32 crc ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -70,6 +82,9 @@ protected:
   void updateEntryHeaderInfo() ;
 
   // Should/could be moved to zipheadio.h ?!
+  /** Returns the current local time in MS-DOS format. */
+  static int dosTime() ;
+
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
 				     EndOfCentralDirectory eocd,
 				     ostream &os ) ;
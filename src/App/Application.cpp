@@ -476,6 +476,7 @@ Document* Application::newDocument(const char * proposedName, const char * propo
     doc->signalBeforeChange.connect(std::bind(&Application::slotBeforeChangeDocument, this, sp::_1, sp::_2));
     doc->signalChanged.connect(std::bind(&Application::slotChangedDocument, this, sp::_1, sp::_2));
     doc->signalNewObject.connect(std::bind(&Application::slotNewObject, this, sp::_1));
+    doc->signalNewObjects.connect(std::bind(&Application::slotNewObjects, this, sp::_1));
     doc->signalDeletedObject.connect(std::bind(&Application::slotDeletedObject, this, sp::_1));
     doc->signalBeforeChangeObject.connect(std::bind(&Application::slotBeforeChangeObject, this, sp::_1, sp::_2));
     doc->signalChangedObject.connect(std::bind(&Application::slotChangedObject, this, sp::_1, sp::_2));
@@ -1568,6 +1569,15 @@ void Application::slotNewObject(const DocumentObject& obj)
     _objCount = -1;
 }
 
+void Application::slotNewObjects(const std::vector<DocumentObject*>& objs)
+{
+    // Observers of the application still get each object of a batch
+    for (auto obj : objs) {
+        this->signalNewObject(*obj);
+    }
+    _objCount = -1;
+}
+
 void Application::slotDeletedObject(const DocumentObject& obj)
 {
     this->signalDeletedObject(obj);
@@ -2098,6 +2108,7 @@ void Application::initTypes()
     // Test features
     App::FeatureTest               ::init();
     App::FeatureTestException      ::init();
+    App::FeatureTestThreadSafe     ::init();
     App::FeatureTestColumn         ::init();
     App::FeatureTestRow            ::init();
     App::FeatureTestAbsAddress     ::init();
@@ -875,6 +875,7 @@ protected:
     void slotChangedDocument(const App::Document& doc, const App::Property& prop);
     /// A slot for a newly created object.
     void slotNewObject(const App::DocumentObject& obj);
+    void slotNewObjects(const std::vector<App::DocumentObject*>& objs);
     /// A slot for a deleted object.
     void slotDeletedObject(const App::DocumentObject& obj);
     /// A slot for before a property of an object is changed.
@@ -1003,6 +1004,8 @@ private:
     static PyObject *sGetActiveTransaction  (PyObject *self,PyObject *args);
     static PyObject *sCloseActiveTransaction(PyObject *self,PyObject *args);
     static PyObject *sCheckAbort(PyObject *self,PyObject *args);
+    static PyObject *sSetRecomputeProfiling(PyObject *self,PyObject *args);
+    static PyObject *sGetRecomputeProfile   (PyObject *self,PyObject *args);
     static PyMethodDef    Methods[];
     // clang-format on
 
@@ -37,6 +37,7 @@
 #include "DocumentPy.h"
 #include "DocumentObserverPython.h"
 #include "DocumentObjectPy.h"
+#include "RecomputeProfiler.h"
 
 
 // using Base::GetConsole;
@@ -265,6 +266,22 @@ PyMethodDef Application::Methods[] = {
      "There is an active sequencer during document restore and recomputation. User may\n"
      "abort the operation by pressing the ESC key. Once detected, this function will\n"
      "trigger a Base.FreeCADAbort exception."},
+    {"setRecomputeProfiling",
+     (PyCFunction)Application::sSetRecomputeProfiling,
+     METH_VARARGS,
+     "setRecomputeProfiling(enable=True, clear=True) -- start or stop profiling recomputes.\n\n"
+     "When enabled, each object recompute is recorded with its wall time, its time\n"
+     "spent in Python and in the geometry kernel, and nested sub-operations.\n"
+     "If 'clear' is True, previously recorded calls are discarded when starting."},
+    {"getRecomputeProfile",
+     (PyCFunction)Application::sGetRecomputeProfile,
+     METH_VARARGS,
+     "getRecomputeProfile(format='json', clear=False) -> str\n\n"
+     "Return the calls recorded by the recompute profiler. Times are in microseconds.\n"
+     "format: 'json' for the nested calls together with a per-object summary sorted\n"
+     "        by duration, or 'chrome' for the Chrome trace event format, which can\n"
+     "        be loaded in chrome://tracing or Perfetto as a flame graph.\n"
+     "clear: discard the recorded calls afterwards."},
     {nullptr, nullptr, 0, nullptr} /* Sentinel */
 };
 
@@ -1178,6 +1195,57 @@ PyObject* Application::sCloseActiveTransaction(PyObject* /*self*/, PyObject* arg
     PY_CATCH;
 }
 
+PyObject* Application::sSetRecomputeProfiling(PyObject* /*self*/, PyObject* args)
+{
+    PyObject* enable = Py_True;
+    PyObject* clear = Py_True;
+    if (!PyArg_ParseTuple(args, "|O!O!", &PyBool_Type, &enable, &PyBool_Type, &clear)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto& profiler = RecomputeProfiler::instance();
+        if (Base::asBoolean(enable) && Base::asBoolean(clear)) {
+            profiler.clear();
+        }
+        profiler.setEnabled(Base::asBoolean(enable));
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
+PyObject* Application::sGetRecomputeProfile(PyObject* /*self*/, PyObject* args)
+{
+    const char* format = "json";
+    PyObject* clear = Py_False;
+    if (!PyArg_ParseTuple(args, "|sO!", &format, &PyBool_Type, &clear)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        RecomputeProfiler::Format fmt {};
+        if (strcmp(format, "json") == 0) {
+            fmt = RecomputeProfiler::Format::Json;
+        }
+        else if (strcmp(format, "chrome") == 0) {
+            fmt = RecomputeProfiler::Format::ChromeTrace;
+        }
+        else {
+            PyErr_Format(PyExc_ValueError, "Unknown format '%s'", format);
+            return nullptr;
+        }
+        auto& profiler = RecomputeProfiler::instance();
+        Py::String ret(profiler.dump(fmt));
+        if (Base::asBoolean(clear)) {
+            profiler.clear();
+        }
+        return Py::new_reference_to(ret);
+    }
+    PY_CATCH;
+}
+
 PyObject* Application::sCheckAbort(PyObject* /*self*/, PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -23,8 +23,13 @@
  ***************************************************************************/
 
 #include <bitset>
+#include <condition_variable>
 #include <stack>
 #include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <iostream>
 #include <utility>
 #include <set>
@@ -34,7 +39,9 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <exception>
 #include <filesystem>
+#include <limits>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/bimap.hpp>
@@ -75,6 +82,7 @@
 #include "License.h"
 #include "Link.h"
 #include "MergeDocuments.h"
+#include "RecomputeProfiler.h"
 #include "StringHasher.h"
 #include "Transactions.h"
 
@@ -109,6 +117,114 @@ namespace App
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
 
+// Notifications raised by an object being recomputed on a worker thread. They
+// are queued here and sent on the main thread once the object is done, because
+// observers (view providers, Python observers, etc.) are not thread safe.
+static thread_local std::vector<std::function<void()>>* globalDeferredNotifications;
+
+/**
+ * A pool of worker threads used by Document::_recomputeParallel() to recompute
+ * thread safe objects. The pool lives for the duration of a single recompute.
+ */
+class RecomputeWorkers
+{
+public:
+    struct Result
+    {
+        std::size_t index;
+        int code;
+        std::vector<std::function<void()>> notifications;
+    };
+
+    RecomputeWorkers(unsigned count, std::function<int(DocumentObject*)> recompute)
+        : recompute(std::move(recompute))
+    {
+        threads.reserve(count);
+        for (unsigned i = 0; i < count; ++i) {
+            threads.emplace_back([this]() { run(); });
+        }
+    }
+
+    ~RecomputeWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+            tasks.clear();
+        }
+        taskReady.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    RecomputeWorkers(const RecomputeWorkers&) = delete;
+    RecomputeWorkers(RecomputeWorkers&&) = delete;
+    RecomputeWorkers& operator=(const RecomputeWorkers&) = delete;
+    RecomputeWorkers& operator=(RecomputeWorkers&&) = delete;
+
+    void push(DocumentObject* obj, std::size_t index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back(obj, index);
+        }
+        taskReady.notify_one();
+    }
+
+    /// Wait for the next finished object
+    Result wait()
+    {
+        // Release the GIL while blocking so that workers can run Python code
+        std::optional<Base::PyGILStateRelease> release;
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            release.emplace();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        resultReady.wait(lock, [this]() { return !results.empty(); });
+        Result result = std::move(results.front());
+        results.pop_front();
+        return result;
+    }
+
+private:
+    void run()
+    {
+        for (;;) {
+            std::pair<DocumentObject*, std::size_t> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskReady.wait(lock, [this]() { return stop || !tasks.empty(); });
+                if (stop) {
+                    return;
+                }
+                task = tasks.front();
+                tasks.pop_front();
+            }
+            Result result {task.second, 1, {}};
+            globalDeferredNotifications = &result.notifications;
+            result.code = recompute(task.first);
+            globalDeferredNotifications = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results.push_back(std::move(result));
+            }
+            resultReady.notify_one();
+        }
+    }
+
+    std::function<int(DocumentObject*)> recompute;
+    std::vector<std::thread> threads;
+    std::deque<std::pair<DocumentObject*, std::size_t>> tasks;
+    std::deque<Result> results;
+    std::mutex mutex;
+    std::condition_variable taskReady;
+    std::condition_variable resultReady;
+    bool stop {false};
+};
+
+std::atomic<int64_t> DocumentP::objectGeneration;
+
 DocumentP::DocumentP()
 {
     static std::random_device rd;
@@ -184,7 +300,15 @@ bool Document::undo(const int id)
         {
             Base::FlagToggler<bool> flag(d->undoing);
             // applying the undo
-            mUndoTransactions.back()->apply(*this, false);
+            try {
+                mUndoTransactions.back()->apply(*this, false);
+            }
+            catch (...) {
+                // The undo is not applied and stays on the stack
+                delete d->activeUndoTransaction;
+                d->activeUndoTransaction = nullptr;
+                throw;
+            }
 
             // save the redo
             mRedoMap[d->activeUndoTransaction->getID()] = d->activeUndoTransaction;
@@ -237,7 +361,15 @@ bool Document::redo(const int id)
         // do the redo
         {
             Base::FlagToggler<bool> flag(d->undoing);
-            mRedoTransactions.back()->apply(*this, true);
+            try {
+                mRedoTransactions.back()->apply(*this, true);
+            }
+            catch (...) {
+                // The redo is not applied and stays on the stack
+                delete d->activeUndoTransaction;
+                d->activeUndoTransaction = nullptr;
+                throw;
+            }
 
             mUndoMap[d->activeUndoTransaction->getID()] = d->activeUndoTransaction;
             mUndoTransactions.push_back(d->activeUndoTransaction);
@@ -491,6 +623,8 @@ void Document::_commitTransaction(const bool notify)
     }
 
     if (d->activeUndoTransaction) {
+        // Announce the objects of a batch within the transaction they belong to
+        _announceBatch();
         Base::FlagToggler<> flag(d->committing);
         Application::TransactionSignaller signaller(false, true);
         const int id = d->activeUndoTransaction->getID();
@@ -502,6 +636,7 @@ void Document::_commitTransaction(const bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        _spillTransactions();
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -533,6 +668,8 @@ void Document::_abortTransaction()
     }
 
     if (d->activeUndoTransaction) {
+        // Announce the objects of a batch within the transaction they belong to
+        _announceBatch();
         Base::FlagToggler<bool> flag(d->rollback);
         Application::TransactionSignaller signaller(true, true);
 
@@ -605,6 +742,7 @@ void Document::clearDocument() // NOLINT
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->clearTopoOrder();
     d->objectMap.clear();
     d->objectNameManager.clear();
     d->objectIdMap.clear();
@@ -703,12 +841,47 @@ int Document::getUndoMode() const
 
 unsigned int Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = 0;
+    for (auto trans : mUndoTransactions) {
+        size += trans->getCopySize();
+    }
+    for (auto trans : mRedoTransactions) {
+        size += trans->getCopySize();
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
 {
     d->UndoMemSize = UndoMemSize;
+    _spillTransactions();
+}
+
+void Document::_spillTransactions()
+{
+    if (d->UndoMemSize == 0 || mUndoTransactions.size() < 2) {
+        return;
+    }
+    std::size_t used = 0;
+    for (auto trans : mUndoTransactions) {
+        used += trans->getCopySize();
+    }
+    // Start with the oldest step and always keep the last one in memory
+    for (auto it = mUndoTransactions.begin();
+         used > d->UndoMemSize && std::next(it) != mUndoTransactions.end();
+         ++it) {
+        auto trans = *it;
+        if (trans->isSpilled()) {
+            continue;
+        }
+        std::size_t size = trans->getCopySize();
+        std::string file = TransientDir.getStrValue() + "/Undo"
+            + std::to_string(trans->getID()) + ".fcstd";
+        if (trans->spill(file)) {
+            used -= size - trans->getCopySize();
+        }
+    }
 }
 
 void Document::setMaxUndoStackSize(const unsigned int UndoMaxStackSize) // NOLINT
@@ -793,10 +966,14 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
-    if (Who->isDerivedFrom<DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
+    auto obj = freecad_cast<const DocumentObject*>(Who);
+    if (obj && !obj->testStatus(ObjectStatus::PendingNotify)) {
+        if (!deferNotification([this, obj, What]() { signalBeforeChangeObject(*obj, *What); })) {
+            signalBeforeChangeObject(*obj, *What);
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
+        std::lock_guard<std::recursive_mutex> lock(d->recomputeMutex);
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
@@ -806,6 +983,21 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (Who->testStatus(ObjectStatus::PendingNotify)) {
+        // Announced with its final state when the batch ends
+        return;
+    }
+    // Replayed on the calling thread of recompute, see _recomputeParallel()
+    if (deferNotification([this, Who, What]() { onChangedProperty(Who, What); })) {
+        return;
+    }
+    if (d->coalesceDepth > 0 && What->getName()) {
+        // Delivered once more in bulk when coalescing ends, see endCoalesceChanges()
+        std::pair<long, std::string> entry(Who->getID(), What->getName());
+        if (d->coalescedChangeSet.insert(entry).second) {
+            d->coalescedChanges.push_back(std::move(entry));
+        }
+    }
     signalChangedObject(*Who, *What);
 }
 
@@ -1823,11 +2015,15 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setThreads(static_cast<int>(hGrp->GetInt("SaveThreads", 0)));
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        if (hGrp->GetBool("SaveBinaryLists", false)) {
+            writer.setMode("BinaryLists");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << '\n'
                         << "<!--" << '\n'
@@ -1946,6 +2142,7 @@ void Document::restore(const char* filename,
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->clearTopoOrder();
     d->objectNameManager.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
@@ -2000,6 +2197,14 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
+
+    // Parse the data files of e.g. shapes and meshes on worker threads, 1 reads them one by one
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    reader.FileThreads = static_cast<int>(std::max(0L, hGrp->GetInt("RestoreThreads", 0)));
+    if (reader.FileThreads == 0) {
+        reader.FileThreads = static_cast<int>(std::thread::hardware_concurrency());
+    }
     reader.readFiles(zipstream);
 
     DocumentP::checkStringHasher(reader);
@@ -2611,6 +2816,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                         int options)
 {
     ZoneScoped;
+    RecomputeProfiler::Scope profile("recompute", RecomputeProfiler::Category::Document);
 
     if (d->undoing || d->rollback) {
         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
@@ -2653,28 +2859,18 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         d->_preRecomputeHook();
     }
 
-    //////////////////////////////////////////////////////////////////////////
-    // FIXME Comment by Realthunder:
-    // the topologicalSrot() below cannot handle partial recompute, haven't got
-    // time to figure out the code yet, simply use back boost::topological_sort
-    // for now, that is, rely on getDependencyList() to do the sorting. The
-    // downside is, it didn't take advantage of the ready built InList, nor will
-    // it report for cyclic dependency.
-    //////////////////////////////////////////////////////////////////////////
-
-    /*   // get the sorted vector of all dependent objects and go though it from the end
-       auto depObjs = getDependencyList(objs.empty()?d->objectArray:objs);
-       vector<DocumentObject*> topoSortedObjects = topologicalSort(depObjs);
-       if (topoSortedObjects.size() != depObjs.size()){
-           cerr << "Document::recompute(): cyclic dependency detected" << '\n';
-           topoSortedObjects = d->partialTopologicalSort(depObjs);
-       }
-       std::reverse(topoSortedObjects.begin(),topoSortedObjects.end());
-   */
-
-    // alt:
-    auto topoSortedObjects =
-        getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    // Use the dependency order maintained on link changes, so that sorting
+    // only costs time proportional to the objects involved. Fall back to a
+    // full sort by getDependencyList() on external or cyclic links, which also
+    // reports the cycles.
+    std::vector<DocumentObject*> topoSortedObjects;
+    if (!_sortDependencies(objs, options, topoSortedObjects)) {
+        topoSortedObjects =
+            getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+        if (objs.empty()) {
+            _resetDependencyOrder(topoSortedObjects);
+        }
+    }
 
     for (auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute, true);
@@ -2683,6 +2879,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     ParameterGrp::handle hGrp =
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
 
     FC_TIME_INIT(t2);
 
@@ -2697,6 +2894,13 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            if (passes == 0 && parallel) {
+                if (_recomputeParallel(topoSortedObjects, filter, seq.get(), hasError, objectCount)
+                    < 0) {
+                    passes = 2;
+                }
+                idx = topoSortedObjects.size();
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -2805,6 +3009,372 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     return objectCount;
 }
 
+void Document::_addDependency(DocumentObject* obj, DocumentObject* dep)
+{
+    if (obj == dep || d->topoOrderDirty) {
+        return;
+    }
+    auto inOrder = [this](const DocumentObject* o) {
+        return o->getDocument() == this && o->_topoIndex < d->topoOrder.size()
+            && d->topoOrder[o->_topoIndex] == o;
+    };
+    if (!inOrder(obj) || !inOrder(dep)) {
+        return;
+    }
+    if (testStatus(Document::Restoring) || d->batchDepth > 0) {
+        // Links are restored in file order, or added in bulk while batching,
+        // simply re-sort on next recompute
+        d->topoOrderDirty = true;
+        return;
+    }
+    const std::size_t lower = obj->_topoIndex;
+    const std::size_t upper = dep->_topoIndex;
+    if (upper < lower) {
+        return;
+    }
+
+    // Pearce-Kelly dynamic topological sort. Collect the dependents of obj
+    // ordered before dep, and the dependencies of dep ordered after obj. Only
+    // these need to be reordered, with the latter moved in front.
+    std::unordered_set<DocumentObject*> visited;
+    std::vector<DocumentObject*> forward;
+    std::vector<DocumentObject*> stack {obj};
+    visited.insert(obj);
+    while (!stack.empty()) {
+        auto o = stack.back();
+        stack.pop_back();
+        forward.push_back(o);
+        for (auto in : o->getInList()) {
+            if (in == dep) {
+                // cyclic dependency, let getDependencyList() report it
+                d->topoOrderDirty = true;
+                return;
+            }
+            if (inOrder(in) && in->_topoIndex < upper && visited.insert(in).second) {
+                stack.push_back(in);
+            }
+        }
+    }
+
+    std::vector<DocumentObject*> backward;
+    std::vector<DocumentObject*> outList;
+    stack.push_back(dep);
+    visited.insert(dep);
+    while (!stack.empty()) {
+        auto o = stack.back();
+        stack.pop_back();
+        backward.push_back(o);
+        outList.clear();
+        o->getOutList(0, outList);
+        for (auto out : outList) {
+            if (out && inOrder(out) && out->_topoIndex > lower && visited.insert(out).second) {
+                stack.push_back(out);
+            }
+        }
+    }
+
+    auto byIndex = [](const DocumentObject* a, const DocumentObject* b) {
+        return a->_topoIndex < b->_topoIndex;
+    };
+    std::sort(forward.begin(), forward.end(), byIndex);
+    std::sort(backward.begin(), backward.end(), byIndex);
+    std::vector<std::size_t> indices;
+    indices.reserve(forward.size() + backward.size());
+    for (auto o : backward) {
+        indices.push_back(o->_topoIndex);
+    }
+    for (auto o : forward) {
+        indices.push_back(o->_topoIndex);
+    }
+    std::sort(indices.begin(), indices.end());
+    auto it = indices.begin();
+    for (auto o : backward) {
+        o->_topoIndex = *it++;
+        d->topoOrder[o->_topoIndex] = o;
+    }
+    for (auto o : forward) {
+        o->_topoIndex = *it++;
+        d->topoOrder[o->_topoIndex] = o;
+    }
+}
+
+bool Document::_sortDependencies(const std::vector<DocumentObject*>& objs,
+                                 int options,
+                                 std::vector<DocumentObject*>& sorted)
+{
+    if (d->topoOrderDirty) {
+        return false;
+    }
+
+    const int op = ((options & DepNoXLinked) != 0) ? DocumentObject::OutListNoXLinked : 0;
+    sorted.clear();
+    if (objs.empty()) {
+        sorted.reserve(d->topoOrder.size() - d->topoOrderHoles);
+        for (auto obj : d->topoOrder) {
+            if (obj) {
+                sorted.push_back(obj);
+            }
+        }
+    }
+    else {
+        // collect the objects and their dependencies like buildDependencyList()
+        std::unordered_set<DocumentObject*> visited;
+        std::vector<DocumentObject*> stack;
+        std::vector<DocumentObject*> outList;
+        for (auto obj : objs) {
+            if (obj && visited.insert(obj).second) {
+                stack.push_back(obj);
+            }
+        }
+        while (!stack.empty()) {
+            auto obj = stack.back();
+            stack.pop_back();
+            if (!obj->isAttachedToDocument()) {
+                continue;
+            }
+            if (obj->getDocument() != this) {
+                return false;
+            }
+            sorted.push_back(obj);
+            outList.clear();
+            obj->getOutList(op, outList);
+            for (auto dep : outList) {
+                if (dep && visited.insert(dep).second) {
+                    stack.push_back(dep);
+                }
+            }
+        }
+        std::sort(sorted.begin(), sorted.end(), [](auto a, auto b) {
+            return a->_topoIndex < b->_topoIndex;
+        });
+    }
+
+    // Verify the order, as not all links are tracked by back links, e.g. the
+    // ones with hidden scope.
+    std::vector<DocumentObject*> outList;
+    for (auto obj : sorted) {
+        outList.clear();
+        obj->getOutList(op, outList);
+        for (auto dep : outList) {
+            if (!dep || !dep->isAttachedToDocument()) {
+                continue;
+            }
+            if (dep->getDocument() != this) {
+                return false;
+            }
+            if (dep->_topoIndex >= obj->_topoIndex) {
+                d->topoOrderDirty = true;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void Document::_resetDependencyOrder(const std::vector<DocumentObject*>& sorted)
+{
+    d->clearTopoOrder();
+    d->topoOrder.reserve(d->objectArray.size());
+    for (auto obj : sorted) {
+        if (obj->getDocument() == this) {
+            obj->_topoIndex = d->topoOrder.size();
+            d->topoOrder.push_back(obj);
+        }
+    }
+    if (d->topoOrder.size() != d->objectArray.size()) {
+        // Should not happen as all objects are involved in a full recompute
+        d->topoOrderDirty = true;
+    }
+}
+
+bool Document::deferNotification(std::function<void()> notify)
+{
+    if (!globalDeferredNotifications) {
+        return false;
+    }
+    globalDeferredNotifications->push_back(std::move(notify));
+    return true;
+}
+
+int Document::_recomputeParallel(const std::vector<DocumentObject*>& objs,
+                                 std::set<DocumentObject*>& filter,
+                                 Base::SequencerLauncher* seq,
+                                 bool* hasError,
+                                 int& objectCount)
+{
+    const std::size_t count = objs.size();
+    std::unordered_map<const DocumentObject*, std::size_t> indices;
+    indices.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        indices.emplace(objs[i], i);
+    }
+
+    // For each object, the number of its dependencies not yet done and the
+    // objects that are waiting for it.
+    std::vector<int> pending(count, 0);
+    std::vector<std::vector<std::size_t>> dependents(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto outList = objs[i]->getOutList();
+        std::sort(outList.begin(), outList.end());
+        outList.erase(std::unique(outList.begin(), outList.end()), outList.end());
+        for (auto dep : outList) {
+            auto it = indices.find(dep);
+            if (it != indices.end() && it->second != i) {
+                ++pending[i];
+                dependents[it->second].push_back(i);
+            }
+        }
+    }
+
+    std::deque<std::size_t> ready;
+    std::vector<bool> scheduled(count, false);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (pending[i] == 0) {
+            ready.push_back(i);
+            scheduled[i] = true;
+        }
+    }
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    auto threadCount = static_cast<unsigned>(std::max(0L, hGrp->GetInt("RecomputeThreads", 0)));
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    // Created on first use, as most recomputes only involve objects that
+    // must run on the calling thread.
+    std::unique_ptr<RecomputeWorkers> workers;
+    std::size_t running = 0;
+    std::size_t finished = 0;
+    std::size_t next = 0;
+    // Set if the user aborts the recompute, rethrown by abort()
+    std::exception_ptr aborted;
+
+    auto release = [&](std::size_t idx) {
+        ++finished;
+        for (auto dep : dependents[idx]) {
+            if (--pending[dep] <= 0 && !scheduled[dep]) {
+                ready.push_back(dep);
+                scheduled[dep] = true;
+            }
+        }
+    };
+
+    // Same handling of the result as the serial recompute in recompute()
+    auto finish = [&](std::size_t idx, bool doRecompute, int res) {
+        auto obj = objs[idx];
+        if (res != 0) {
+            if (hasError) {
+                *hasError = true;
+            }
+            if (res < 0) {
+                return false;
+            }
+            obj->getInListEx(filter, true);
+            filter.insert(obj);
+            release(idx);
+            return true;
+        }
+        if (obj->isTouched() || doRecompute) {
+            signalRecomputedObject(*obj);
+            obj->purgeTouched();
+            for (auto inObjIt : obj->getInList()) {
+                inObjIt->enforceRecompute();
+            }
+        }
+        if (seq && !aborted) {
+            try {
+                seq->next(true);
+            }
+            catch (const Base::AbortException&) {
+                aborted = std::current_exception();
+            }
+        }
+        release(idx);
+        return !aborted;
+    };
+
+    // On abort, wait for the objects still running on the workers, so that
+    // their notifications are sent and their status is updated
+    auto abort = [&]() {
+        while (running > 0) {
+            auto result = workers->wait();
+            --running;
+            for (auto& notify : result.notifications) {
+                notify();
+            }
+            finish(result.index, true, result.code);
+        }
+        if (aborted) {
+            std::rethrow_exception(aborted);
+        }
+        return -1;
+    };
+
+    while (finished < count) {
+        if (ready.empty() && running == 0) {
+            // Only objects with cyclic dependencies are left. Fall back to the
+            // sorted order.
+            while (scheduled[next]) {
+                ++next;
+            }
+            ready.push_back(next);
+            scheduled[next] = true;
+        }
+
+        while (!ready.empty()) {
+            auto idx = ready.front();
+            ready.pop_front();
+            auto obj = objs[idx];
+            if (!obj->isAttachedToDocument() || filter.contains(obj)) {
+                release(idx);
+                continue;
+            }
+            if (!obj->mustRecompute()) {
+                if (!finish(idx, false, 0)) {
+                    return abort();
+                }
+                continue;
+            }
+            ++objectCount;
+            if (threadCount > 1 && obj->isRecomputeThreadSafe()) {
+                if (!workers) {
+                    workers = std::make_unique<RecomputeWorkers>(
+                        threadCount,
+                        [this](DocumentObject* feat) {
+                            try {
+                                return _recomputeFeature(feat);
+                            }
+                            catch (...) {
+                                d->addRecomputeLog("Unknown exception!", feat);
+                                return 1;
+                            }
+                        });
+                }
+                workers->push(obj, idx);
+                ++running;
+                continue;
+            }
+            if (!finish(idx, true, _recomputeFeature(obj))) {
+                return abort();
+            }
+        }
+
+        if (running > 0) {
+            auto result = workers->wait();
+            --running;
+            for (auto& notify : result.notifications) {
+                notify();
+            }
+            if (!finish(result.index, true, result.code)) {
+                return abort();
+            }
+        }
+    }
+    return 0;
+}
+
 /*!
   Does almost the same as topologicalSort() until no object with an input degree of zero
   can be found. It then searches for objects with an output degree of zero until neither
@@ -2992,6 +3562,9 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
     FC_LOG("Recomputing " << Feat->getFullName());
+    RecomputeProfiler::Scope profile("recomputeFeature",
+                                     RecomputeProfiler::Category::Feature,
+                                     Feat);
 
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
@@ -3139,6 +3712,150 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
     return objects;
 }
 
+void Document::beginBatch()
+{
+    ++d->batchDepth;
+}
+
+void Document::endBatch()
+{
+    if (d->batchDepth <= 0 || --d->batchDepth > 0) {
+        return;
+    }
+    _announceBatch();
+}
+
+void Document::_announceBatch()
+{
+    // Objects added by the handlers below go to a new list
+    std::vector<std::pair<DocumentObject*, Transaction*>> entries;
+    entries.swap(d->batchObjects);
+
+    std::vector<DocumentObject*> objects;
+    std::vector<std::pair<long, Transaction*>> transactions;
+    objects.reserve(entries.size());
+    for (auto [obj, transaction] : entries) {
+        if (!obj || !obj->testStatus(ObjectStatus::PendingNotify)) {
+            continue;
+        }
+        obj->setStatus(ObjectStatus::PendingNotify, false);
+        objects.push_back(obj);
+        if (transaction) {
+            transactions.emplace_back(obj->getID(), transaction);
+        }
+    }
+    if (objects.empty()) {
+        return;
+    }
+
+    // Add the back links held back while the objects were pending, see
+    // DocumentObject::_addBackLink(), and re-sort on next recompute
+    d->topoOrderDirty = true;
+    for (auto obj : objects) {
+        // Same links as maintained by the link properties, i.e. without hidden
+        // and expression links
+        for (auto link : obj->getOutList(DocumentObject::OutListNoExpression)) {
+            link->_addBackLink(obj);
+        }
+    }
+
+    bool activated = std::ranges::find(objects, d->activeObject) != objects.end();
+    signalNewObjects(objects);
+
+    // The handlers may remove objects, so look them up again
+    for (auto [id, transaction] : transactions) {
+        auto it = d->objectIdMap.find(id);
+        // Only if the object is still recorded in the same transaction
+        if (it != d->objectIdMap.end() && transaction == d->activeUndoTransaction) {
+            signalTransactionAppend(*it->second, transaction);
+        }
+    }
+    if (activated && d->activeObject) {
+        signalActivatedObject(*d->activeObject);
+    }
+}
+
+bool Document::isBatching() const
+{
+    return d->batchDepth > 0;
+}
+
+Document::BatchScope::BatchScope(Document* doc)
+    : doc(doc)
+{
+    doc->beginBatch();
+}
+
+Document::BatchScope::~BatchScope()
+{
+    try {
+        doc->endBatch();
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR("Exception on finishing batch: " << e.what());
+    }
+}
+
+void Document::beginCoalesceChanges()
+{
+    ++d->coalesceDepth;
+}
+
+void Document::endCoalesceChanges()
+{
+    if (d->coalesceDepth <= 0 || --d->coalesceDepth > 0) {
+        return;
+    }
+
+    std::vector<std::pair<long, std::string>> entries;
+    entries.swap(d->coalescedChanges);
+    d->coalescedChangeSet.clear();
+
+    // Objects and properties may have been removed in the meantime, so look
+    // them up again
+    std::vector<std::pair<const DocumentObject*, const Property*>> changes;
+    changes.reserve(entries.size());
+    for (auto& entry : entries) {
+        auto it = d->objectIdMap.find(entry.first);
+        if (it == d->objectIdMap.end()) {
+            continue;
+        }
+        if (auto prop = it->second->getPropertyByName(entry.second.c_str())) {
+            changes.emplace_back(it->second, prop);
+        }
+    }
+    if (!changes.empty()) {
+        signalChangedObjects(changes);
+    }
+}
+
+bool Document::isCoalescingChanges() const
+{
+    return d->coalesceDepth > 0;
+}
+
+Document::CoalesceScope::CoalesceScope(Document* doc)
+    : doc(doc)
+{
+    doc->beginCoalesceChanges();
+}
+
+Document::CoalesceScope::~CoalesceScope()
+{
+    try {
+        doc->endCoalesceChanges();
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR("Exception on delivering changes: " << e.what());
+    }
+}
+
 void Document::addObject(DocumentObject* obj, const char* name)
 {
     if (obj->getDocument()) {
@@ -3163,6 +3880,10 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
  
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
+    ++DocumentP::objectGeneration;
+    if (d->batchDepth > 0) {
+        pcObject->setStatus(ObjectStatus::PendingNotify, true);
+    }
     d->objectNameManager.addExactName(ObjectName);
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
@@ -3176,6 +3897,8 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    pcObject->_topoIndex = d->topoOrder.size();
+    d->topoOrder.push_back(pcObject);
      
      // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3208,6 +3931,15 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
+    if (pcObject->testStatus(ObjectStatus::PendingNotify)) {
+        // Announced when the batch ends, see endBatch()
+        d->batchObjects.emplace_back(pcObject, d->rollback ? nullptr : d->activeUndoTransaction);
+        if (options.testFlag(AddObjectOption::ActivateObject)) {
+            d->activeObject = pcObject;
+        }
+        return;
+    }
+
     signalNewObject(*pcObject);
  
     // do no transactions if we do a rollback!
@@ -3296,8 +4028,23 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
     if (!d->undoing && !d->rollback) {
         pcObject->unsetupObject();
     }
-    signalDeletedObject(*pcObject);
-    signalTransactionRemove(*pcObject, d->rollback ? nullptr : d->activeUndoTransaction);
+    if (!d->batchObjects.empty()) {
+        // Keep the entry as a hole, the list is announced as a whole
+        auto it = std::find_if(d->batchObjects.begin(),
+                               d->batchObjects.end(),
+                               [pcObject](const auto& entry) { return entry.first == pcObject; });
+        if (it != d->batchObjects.end()) {
+            it->first = nullptr;
+        }
+    }
+    if (pcObject->testStatus(ObjectStatus::PendingNotify)) {
+        // The object has never been announced, so there is nobody to tell
+        pcObject->setStatus(ObjectStatus::PendingNotify, false);
+    }
+    else {
+        signalDeletedObject(*pcObject);
+        signalTransactionRemove(*pcObject, d->rollback ? nullptr : d->activeUndoTransaction);
+    }
     breakDependency(pcObject, true);
 
     // TODO Check me if it's needed (2015-09-01, Fat-Zer)
@@ -3335,6 +4082,19 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
             break;
         }
     }
+
+    if (pcObject->_topoIndex < d->topoOrder.size()
+        && d->topoOrder[pcObject->_topoIndex] == pcObject) {
+        d->topoOrder[pcObject->_topoIndex] = nullptr;
+        // compact once half of the entries are holes
+        if (++d->topoOrderHoles > d->topoOrder.size() / 2) {
+            std::erase(d->topoOrder, nullptr);
+            for (std::size_t i = 0; i < d->topoOrder.size(); ++i) {
+                d->topoOrder[i]->_topoIndex = i;
+            }
+            d->topoOrderHoles = 0;
+        }
+    }
     
     // In case the object gets deleted the pointer must be nullified
     if (tobedestroyed) {
@@ -3344,6 +4104,7 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
     // Erase last to avoid invalidating pcObject->pcNameInDocument 
     // when it is still needed in Transaction::addObjectNew
     d->objectMap.erase(pos);
+    ++DocumentP::objectGeneration;
 }
 
 void Document::breakDependency(DocumentObject* pcObject, const bool clear) // NOLINT
@@ -3611,6 +4372,26 @@ std::string Document::getUniqueObjectName(const char* proposedName) const
     return d->objectNameManager.makeUniqueName(cleanName, 3);
 }
 
+std::vector<std::string> Document::getUniqueObjectNames(const char* proposedName,
+                                                        std::size_t count) const
+{
+    if (!proposedName || *proposedName == '\0' || count == 0) {
+        return {};
+    }
+    std::string cleanName = Base::Tools::getIdentifier(proposedName);
+
+    if (d->objectNameManager.containsName(cleanName)) {
+        return d->objectNameManager.makeUniqueNames(cleanName, count, 3);
+    }
+    // The first object gets the proposed name as it is, and the rest are made
+    // unique as if it was already taken.
+    d->objectNameManager.addExactName(cleanName);
+    auto names = d->objectNameManager.makeUniqueNames(cleanName, count - 1, 3);
+    d->objectNameManager.removeExactName(cleanName);
+    names.insert(names.begin(), std::move(cleanName));
+    return names;
+}
+
     bool
 Document::haveSameBaseName(const std::string& name, const std::string& label)
 {
@@ -37,7 +37,9 @@
 #include "PropertyStandard.h"
 #include "ExportInfo.h"
 
+#include <functional>
 #include <map>
+#include <set>
 #include <vector>
 #include <utility>
 #include <list>
@@ -45,6 +47,7 @@
 
 namespace Base
 {
+class SequencerLauncher;
 class Writer;
 }
 
@@ -245,6 +248,11 @@ public:
                                  const std::map<std::string, std::string>&)> signalImportViewObjects;
     /// Signal after finishing importing objects.
     fastsignals::signal<void(const std::vector<DocumentObject*>&)> signalFinishImportObjects;
+    /// Signal on new objects created in a batch instead of signalNewObject, see endBatch().
+    fastsignals::signal<void(const std::vector<DocumentObject*>&)> signalNewObjects;
+    /// Signal with the object changes recorded while coalescing, see beginCoalesceChanges().
+    fastsignals::signal<void(const std::vector<std::pair<const DocumentObject*, const Property*>>&)>
+        signalChangedObjects;
     /// Signal starting a save action to a file.
     fastsignals::signal<void(const Document&, const std::string&)> signalStartSave;
     /// Signal finishing a save action to a file.
@@ -500,6 +508,99 @@ public:
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
 
+    /**
+     * @brief Start creating objects in a batch.
+     *
+     * Objects added to the document until the matching endBatch() are not
+     * announced one by one. signalNewObject, signalTransactionAppend and the
+     * change signals of these objects are held back. The links of these
+     * objects are not added to the InList of the linked objects, and the
+     * dependency order is not updated, until the batch ends. Batches may be
+     * nested.
+     *
+     * The view providers of the objects are only created when the batch ends,
+     * i.e. they do not exist yet inside a batch.
+     *
+     * @sa BatchScope
+     */
+    void beginBatch();
+
+    /**
+     * @brief Finish creating objects in a batch.
+     *
+     * When the outermost batch ends, the back links of the objects created in
+     * the batch and still in the document are added, the dependency order is
+     * re-sorted on the next recompute, and a single signalNewObjects is
+     * emitted with all of them instead of signalNewObject for each. The
+     * objects are announced early, within the batch, if the transaction they
+     * are recorded in is committed or aborted.
+     */
+    void endBatch();
+
+    /// Check whether objects are being created in a batch.
+    bool isBatching() const;
+
+    /**
+     * @brief Start coalescing the change notifications of objects.
+     *
+     * Until the matching endCoalesceChanges(), the changed properties of the
+     * objects are recorded, once per object and property no matter how many
+     * times they were changed, and delivered together at the end through
+     * signalChangedObjects. signalBeforeChangeObject and signalChangedObject
+     * are still emitted on each change. Observers that can wait for the end,
+     * e.g. Gui::Document updating the view providers, skip the latter while
+     * isCoalescingChanges() and handle signalChangedObjects instead. Calls may
+     * be nested.
+     *
+     * @sa CoalesceScope
+     */
+    void beginCoalesceChanges();
+
+    /**
+     * @brief Deliver the coalesced change notifications.
+     *
+     * When the outermost scope ends, a single signalChangedObjects is emitted
+     * with the recorded properties of the objects still in the document, in
+     * the order of their first change. Observers that only need to know about
+     * the changes once may listen to it instead of signalChangedObject.
+     */
+    void endCoalesceChanges();
+
+    /// Check whether change notifications are being coalesced.
+    bool isCoalescingChanges() const;
+
+    /// Create objects in a batch for the lifetime of this object, see beginBatch().
+    class AppExport BatchScope
+    {
+    public:
+        explicit BatchScope(Document* doc);
+        ~BatchScope();
+
+        BatchScope(const BatchScope&) = delete;
+        BatchScope(BatchScope&&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+        BatchScope& operator=(BatchScope&&) = delete;
+
+    private:
+        Document* doc;
+    };
+
+    /// Coalesce change notifications for the lifetime of this object, see beginCoalesceChanges().
+    class AppExport CoalesceScope
+    {
+    public:
+        explicit CoalesceScope(Document* doc);
+        ~CoalesceScope();
+
+        CoalesceScope(const CoalesceScope&) = delete;
+        CoalesceScope(CoalesceScope&&) = delete;
+        CoalesceScope& operator=(const CoalesceScope&) = delete;
+        CoalesceScope& operator=(CoalesceScope&&) = delete;
+
+    private:
+        Document* doc;
+    };
+
     /**
      * @brief Remove an object from the document.
      *
@@ -614,6 +715,22 @@ public:
      */
     std::string getUniqueObjectName(const char* proposedName) const;
 
+    /**
+     * @brief Get several unique names for objects given a proposed name.
+     *
+     * The names are the same as those assigned by adding @p count objects
+     * with the proposed name one after another, but are generated in one
+     * go. Use it with addObjects() to create many objects at a time.
+     *
+     * @param[in] proposedName The proposed name for the objects.
+     * @param[in] count The number of names to generate.
+     *
+     * @return The unique names for the objects or an empty list if the
+     * proposed name is empty.
+     */
+    std::vector<std::string> getUniqueObjectNames(const char* proposedName,
+                                                  std::size_t count) const;
+
     /**
      * @brief Get a unique label for an object.
      *
@@ -909,6 +1026,11 @@ public:
 
     /**
      * @brief Set the undo limit.
+     *
+     * If the undo stack uses more memory, the large property copies of the
+     * oldest steps are written to the transient directory and read back when
+     * needed. Zero means no limit.
+     *
      * @param[in] UndoMemSize The maximum memory in bytes.
      */
     void setUndoLimit(unsigned int UndoMemSize = 0);
@@ -957,6 +1079,8 @@ public:
      * @param[in] id The transaction ID to match or 0 to undo one step.
      *
      * @return Returns true if an undo was done, false if no undo was done.
+     * @throw Base::FileException if the undo step is spilled to a file that
+     * cannot be read back. The step is not applied and kept in this case.
      */
     bool undo(int id = 0);
 
@@ -985,6 +1109,8 @@ public:
      * @param[in] id The transaction ID to match or 0 to redo one step.
      *
      * @return Returns true if a redo was done, false if no redo was done.
+     * @throw Base::FileException if the redo step is spilled to a file that
+     * cannot be read back. The step is not applied and kept in this case.
      */
     bool redo(int id = 0);
 
@@ -1372,9 +1498,83 @@ protected:
      */
     int _recomputeFeature(DocumentObject* Feat);
 
+    /**
+     * @brief Recompute objects concurrently where the dependencies allow it.
+     *
+     * Objects are scheduled as soon as all their dependencies in @p objs are
+     * done.  Objects that are thread safe (see
+     * DocumentObject::isRecomputeThreadSafe()) run on a pool of worker
+     * threads, all others run on the calling thread.
+     *
+     * @param[in] objs The topologically sorted objects to recompute.
+     * @param[in,out] filter The objects to skip, extended by the failed
+     * objects and their dependents.
+     * @param[in] seq The progress indicator, may be `nullptr`.
+     * @param[out] hasError If not `nullptr`, set to true if there was any error.
+     * @param[in,out] objectCount Incremented for each recomputed object.
+     *
+     * @return 0 if succeeded, -1 if aborted by an object.
+     *
+     * @throw Base::AbortException if aborted by user, once the objects still
+     * running on the worker threads are done and their results applied.
+     */
+    int _recomputeParallel(const std::vector<DocumentObject*>& objs,
+                           std::set<DocumentObject*>& filter,
+                           Base::SequencerLauncher* seq,
+                           bool* hasError,
+                           int& objectCount);
+
+    /**
+     * @brief Keep the dependency order up to date on a new link.
+     *
+     * Called when @p obj starts depending on @p dep.  The order maintained by
+     * the document is updated incrementally, only touching the objects
+     * ordered between @p obj and @p dep.
+     *
+     * @param[in] obj The object with the new link.
+     * @param[in] dep The linked object.
+     */
+    void _addDependency(DocumentObject* obj, DocumentObject* dep);
+
+    /**
+     * @brief Sort objects using the dependency order maintained by the document.
+     *
+     * @param[in] objs The objects to sort together with their dependencies.
+     * If empty, all objects of this document are sorted.
+     * @param[in] options A bitmask of DependencyOption.
+     * @param[out] sorted The sorted objects, dependencies first.
+     *
+     * @return true on success. False if the maintained order cannot be used,
+     * e.g. because of external or cyclic links, in which case the caller has
+     * to fall back to getDependencyList().
+     */
+    bool _sortDependencies(const std::vector<DocumentObject*>& objs,
+                           int options,
+                           std::vector<DocumentObject*>& sorted);
+
+    /// Reset the maintained dependency order from a sorted list of all objects.
+    void _resetDependencyOrder(const std::vector<DocumentObject*>& sorted);
+
+    /**
+     * @brief Defer a notification raised on a recompute worker thread.
+     *
+     * @param[in] notify The notification to send.
+     *
+     * @return true if called on a worker thread of a parallel recompute, in
+     * which case @p notify is queued to be called on the main thread.
+     * Otherwise false, and the caller is expected to notify directly.
+     */
+    static bool deferNotification(std::function<void()> notify);
+
     /// Clear the redos.
     void _clearRedos();
 
+    /// Spill the oldest undo transactions to disk if the undo limit is exceeded.
+    void _spillTransactions();
+
+    /// Announce the objects added in a batch so far, see endBatch().
+    void _announceBatch();
+
     /**
      * @brief Get the name of the transient directory for a given UUID and filename.
      *
@@ -146,6 +146,20 @@ class Document(PropertyContainer):
         """
         ...
 
+    def getUniqueObjectNames(self, objName: str, count: int, /) -> list[str]:
+        """
+        Return the names that adding count objects named objName one after another would
+        give, for Example Box -> [Box, Box001, Box002]. Useful to create many objects at a time.
+
+        Args:
+            objName: Object name candidate.
+            count: Number of names to return.
+
+        Returns:
+            List of unique object names based on objName.
+        """
+        ...
+
     def mergeProject(self, path: str, /) -> None:
         """
         Merges this document with another project file.
@@ -184,6 +198,43 @@ class Document(PropertyContainer):
         """
         ...
 
+    def beginBatch(self) -> None:
+        """
+        Start creating objects in a batch.
+
+        Objects added until the matching endBatch() are announced to the observers of
+        the document only when the outermost batch ends, together and with their final
+        state. The changes made to them meanwhile are not notified, and their InList
+        entries in the objects they link to are only added at that time. Their view
+        providers are created at that time too, i.e. obj.ViewObject is None inside a
+        batch. Use try/finally to make sure endBatch() is called.
+        """
+        ...
+
+    def endBatch(self) -> None:
+        """
+        Finish creating objects in a batch, see beginBatch().
+        """
+        ...
+
+    def beginCoalesceChanges(self) -> None:
+        """
+        Start coalescing the change notifications of objects.
+
+        Until the matching endCoalesceChanges(), the changed properties are recorded
+        once each, and delivered together to the observers of the coalesced changes
+        when the outermost scope ends. The observers of each change, e.g.
+        slotChangedObject() of a document observer, are still notified as usual.
+        Use try/finally to make sure endCoalesceChanges() is called.
+        """
+        ...
+
+    def endCoalesceChanges(self) -> None:
+        """
+        Deliver the coalesced change notifications, see beginCoalesceChanges().
+        """
+        ...
+
     def addObject(
         self,
         type: str,
@@ -49,6 +49,7 @@
 #include "ObjectIdentifier.h"
 #include "PropertyExpressionEngine.h"
 #include "PropertyLinks.h"
+#include "private/DocumentP.h"
 
 
 FC_LOG_LEVEL_INIT("App", true, true)
@@ -769,7 +770,9 @@ void DocumentObject::onBeforeChange(const Property* prop)
         onBeforeChangeProperty(_pDoc, prop);
     }
 
-    signalBeforeChange(*this, *prop);
+    if (!Document::deferNotification([this, prop]() { signalBeforeChange(*this, *prop); })) {
+        signalBeforeChange(*this, *prop);
+    }
 }
 
 std::vector<std::pair<Property*, std::unique_ptr<Property>>>
@@ -888,7 +891,8 @@ void DocumentObject::onChanged(const Property* prop)
     // if (_pDoc)
     //     _pDoc->onChangedProperty(this,prop);
 
-    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()) {
+    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()
+        && !testStatus(ObjectStatus::PendingNotify)) {
         _pDoc->signalRelabelObject(*this);
     }
 
@@ -913,7 +917,9 @@ void DocumentObject::onChanged(const Property* prop)
         _pDoc->onChangedProperty(this, prop);
     }
 
-    signalChanged(*this, *prop);
+    if (!Document::deferNotification([this, prop]() { signalChanged(*this, *prop); })) {
+        signalChanged(*this, *prop);
+    }
 }
 
 void DocumentObject::clearOutListCache() const
@@ -991,6 +997,57 @@ DocumentObject* DocumentObject::getSubObject(const char* subname,
     return ret;
 }
 
+DocumentObject* DocumentObject::getCachedSubObject(const char* subname,
+                                                   Base::Matrix4D* mat,
+                                                   bool transform) const
+{
+    auto doc = getDocument();
+    if (!doc || !subname || !subname[0]) {
+        return getSubObject(subname, nullptr, mat, transform);
+    }
+
+    // Limit the memory used by lookups of many different elements
+    const std::size_t maxCacheSize {4096};
+
+    auto& cache = *doc->d;
+    auto key = std::make_tuple(this, transform, std::string(subname));
+    int64_t revision = Property::getLatestRevision();
+    int64_t generation = DocumentP::objectGeneration;
+    {
+        std::lock_guard<std::mutex> lock(cache.subObjectCacheMutex);
+        if (cache.subObjectCacheRevision != revision
+            || cache.subObjectCacheGeneration != generation) {
+            cache.subObjectCache.clear();
+            cache.subObjectCacheRevision = revision;
+            cache.subObjectCacheGeneration = generation;
+        }
+        auto it = cache.subObjectCache.find(key);
+        if (it != cache.subObjectCache.end()) {
+            if (mat) {
+                *mat *= it->second.matrix;
+            }
+            return it->second.object;
+        }
+    }
+
+    Base::Matrix4D matrix;
+    auto ret = getSubObject(subname, nullptr, &matrix, transform);
+    if (mat) {
+        *mat *= matrix;
+    }
+
+    std::lock_guard<std::mutex> lock(cache.subObjectCacheMutex);
+    // Do not store the result if anything changed during the lookup
+    if (cache.subObjectCacheRevision == revision && cache.subObjectCacheGeneration == generation
+        && Property::getLatestRevision() == revision && DocumentP::objectGeneration == generation) {
+        if (cache.subObjectCache.size() >= maxCacheSize) {
+            cache.subObjectCache.clear();
+        }
+        cache.subObjectCache.emplace(std::move(key), DocumentP::SubObjectCacheEntry {ret, matrix});
+    }
+    return ret;
+}
+
 namespace
 {
 std::vector<DocumentObject*>
@@ -1267,6 +1324,10 @@ void DocumentObject::unsetupObject()
 
 void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
 {
+    if (rmvObj && rmvObj->testStatus(ObjectStatus::PendingNotify)) {
+        // Never added, see _addBackLink()
+        return;
+    }
     // do not use erase-remove idom, as this erases ALL entries that match. we only want to remove a
     // single one.
     auto it = std::ranges::find(_inList, rmvObj);
@@ -1281,7 +1342,15 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // the removal: If a link loses this object it removes the backlink. If we would have added it
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
+    if (newObj && newObj->testStatus(ObjectStatus::PendingNotify)) {
+        // The links of objects created in a batch are added all at once when
+        // the batch ends, see Document::endBatch()
+        return;
+    }
     _inList.push_back(newObj);
+    if (_pDoc) {
+        _pDoc->_addDependency(newObj, this);
+    }
 }
 
 int DocumentObject::setElementVisible(const char* element, bool visible)
@@ -1335,7 +1404,13 @@ DocumentObject* DocumentObject::resolve(const char* subname,
         *subElement = nullptr;
     }
 
-    auto obj = getSubObject(subname, pyObj, pmat, transform, depth);
+    DocumentObject* obj = nullptr;
+    if (!pyObj && depth == 0) {
+        obj = getCachedSubObject(subname, pmat, transform);
+    }
+    else {
+        obj = getSubObject(subname, pyObj, pmat, transform, depth);
+    }
     if (!obj || !subname || *subname == 0) {
         return self;
     }
@@ -1384,7 +1459,7 @@ DocumentObject* DocumentObject::resolve(const char* subname,
             if (dot == subname) {
                 break;
             }
-            auto sobj = getSubObject(std::string(subname, dot - subname + 1).c_str());
+            auto sobj = getCachedSubObject(std::string(subname, dot - subname + 1).c_str());
             if (sobj != obj) {
                 if (parent) {
                     // Link/LinkGroup has special visibility handling of plain
@@ -1397,7 +1472,8 @@ DocumentObject* DocumentObject::resolve(const char* subname,
                         if (*ddot != '.') {
                             continue;
                         }
-                        auto sobj = getSubObject(std::string(subname, ddot - subname + 1).c_str());
+                        auto sobj =
+                            getCachedSubObject(std::string(subname, ddot - subname + 1).c_str());
                         if (!sobj->hasExtension(GroupExtension::getExtensionClassTypeId(), false)) {
                             *parent = sobj;
                             break;
@@ -81,6 +81,8 @@ enum ObjectStatus
     RecomputeExtension = 19, ///< Whether the extensions of this object should be recomputed.
     TouchOnColorChange = 20, ///< Whether the object should be touched on color change.
     Freeze = 21, ///< Whether the object is frozen and is excluded from recomputation.
+    /// Whether the object is created in a batch and not yet announced, see Document::beginBatch().
+    PendingNotify = 22,
 };
 // clang-format on
 
@@ -795,6 +797,24 @@ public:
                                          bool transform = true,
                                          int depth = 0) const;
 
+    /**
+     * @brief Get the sub-object by name, using the document's lookup cache.
+     *
+     * Same as getSubObject() without a Python object. Repeated lookups of the
+     * same @p subname return the cached object and transformation until any
+     * property is changed, or any object is added or removed.
+     *
+     * @param[in] subname: dot separated subname, as in getSubObject().
+     * @param[in,out] mat: If not null, it is used as the current
+     * transformation on input, and returns the accumulated transformation.
+     * @param[in] transform: Whether to apply the object's own transformation.
+     *
+     * @return The last document object referred in subname, as in getSubObject().
+     */
+    DocumentObject* getCachedSubObject(const char* subname,
+                                       Base::Matrix4D* mat = nullptr,
+                                       bool transform = true) const;
+
     /**
      * @brief Get a list of objects referenced by a given subname.
      *
@@ -939,6 +959,23 @@ public:
         return false;
     }
 
+    /**
+     * @brief Check whether this object can be recomputed on a worker thread.
+     *
+     * When parallel recompute is enabled, objects returning true here are
+     * recomputed concurrently with other independent objects.  Such an object
+     * must only modify its own properties during recompute, and must not call
+     * into Python.  Property change notifications raised on the worker thread
+     * are replayed on the main thread once the object is done.
+     *
+     * @return true if the object can be recomputed on a worker thread, false
+     * otherwise.
+     */
+    virtual bool isRecomputeThreadSafe() const
+    {
+        return false;
+    }
+
     /**
      * @brief Called when a new label for the document object is proposed.
      *
@@ -1362,6 +1399,8 @@ private:
     mutable std::unordered_map<const char*, App::DocumentObject*, CStringHasher, CStringHasher>
         _outListMap;
     mutable bool _outListCached = false;
+    // position in the dependency order maintained by the document
+    std::size_t _topoIndex {0};
 };
 
 }  // namespace App
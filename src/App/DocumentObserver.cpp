@@ -516,7 +516,7 @@ App::DocumentObject* SubObjectT::getSubObject() const
 {
     auto obj = getObject();
     if (obj) {
-        return obj->getSubObject(subname.c_str());
+        return obj->getCachedSubObject(subname.c_str());
     }
     return nullptr;
 }
@@ -773,6 +773,7 @@ public:
     {
         connectApplicationDeletedDocument.disconnect();
         connectDocumentCreatedObject.disconnect();
+        connectDocumentCreatedObjects.disconnect();
         connectDocumentDeletedObject.disconnect();
         object = nullptr;
         indocument = false;
@@ -788,6 +789,12 @@ public:
             App::Document* doc = obj->getDocument();
             connectDocumentCreatedObject =
                 doc->signalNewObject.connect(std::bind(&Private::createdObject, this, sp::_1));
+            connectDocumentCreatedObjects = doc->signalNewObjects.connect(
+                [this](const std::vector<App::DocumentObject*>& objs) {
+                    for (auto o : objs) {
+                        createdObject(*o);
+                    }
+                });
             connectDocumentDeletedObject =
                 doc->signalDeletedObject.connect(std::bind(&Private::deletedObject, this, sp::_1));
             // NOLINTEND
@@ -803,6 +810,7 @@ public:
     using Connection = fastsignals::scoped_connection;
     Connection connectApplicationDeletedDocument;
     Connection connectDocumentCreatedObject;
+    Connection connectDocumentCreatedObjects;
     Connection connectDocumentDeletedObject;
 };
 
@@ -902,6 +910,12 @@ void DocumentObserver::attachDocument(Document* doc)
         // NOLINTBEGIN
         this->connectDocumentCreatedObject = _document->signalNewObject.connect(
             std::bind(&DocumentObserver::slotCreatedObject, this, sp::_1));
+        this->connectDocumentCreatedObjects = _document->signalNewObjects.connect(
+            [this](const std::vector<App::DocumentObject*>& objs) {
+                for (auto obj : objs) {
+                    slotCreatedObject(*obj);
+                }
+            });
         this->connectDocumentDeletedObject = _document->signalDeletedObject.connect(
             std::bind(&DocumentObserver::slotDeletedObject, this, sp::_1));
         this->connectDocumentChangedObject = _document->signalChangedObject.connect(
@@ -919,6 +933,7 @@ void DocumentObserver::detachDocument()
     if (this->_document) {
         this->_document = nullptr;
         this->connectDocumentCreatedObject.disconnect();
+        this->connectDocumentCreatedObjects.disconnect();
         this->connectDocumentDeletedObject.disconnect();
         this->connectDocumentChangedObject.disconnect();
         this->connectDocumentRecomputedObject.disconnect();
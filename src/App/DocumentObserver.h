@@ -568,6 +568,7 @@ private:
     Connection connectApplicationDeletedDocument;
     Connection connectApplicationActivateDocument;
     Connection connectDocumentCreatedObject;
+    Connection connectDocumentCreatedObjects;
     Connection connectDocumentDeletedObject;
     Connection connectDocumentChangedObject;
     Connection connectDocumentRecomputedObject;
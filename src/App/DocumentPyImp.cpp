@@ -274,6 +274,28 @@ PyObject* DocumentPy::getUniqueObjectName(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::getUniqueObjectNames(PyObject* args)
+{
+    char* sName;
+    Py_ssize_t count;
+    if (!PyArg_ParseTuple(args, "sn", &sName, &count)) {
+        return nullptr;
+    }
+    if (count < 0) {
+        PyErr_SetString(PyExc_ValueError, "count must not be negative");
+        return nullptr;
+    }
+    PY_TRY
+    {
+        Py::List list;
+        for (auto& name : getDocumentPtr()->getUniqueObjectNames(sName, count)) {
+            list.append(Py::String(name));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::mergeProject(PyObject* args)
 {
     char* filename;
@@ -577,6 +599,50 @@ PyObject* DocumentPy::openTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::beginBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->beginBatch();
+    Py_Return;
+}
+
+PyObject* DocumentPy::endBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->endBatch();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::beginCoalesceChanges(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->beginCoalesceChanges();
+    Py_Return;
+}
+
+PyObject* DocumentPy::endCoalesceChanges(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->endCoalesceChanges();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::abortTransaction(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
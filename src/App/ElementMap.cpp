@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -496,6 +497,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         FC_THROWM(Base::RuntimeError, "unexpected end of child element map");  // NOLINT
     }
 
+    finalize();
     return shared_from_this();
 }
 
@@ -510,6 +512,7 @@ MappedName ElementMap::addName(MappedName& name,
             FC_ERR("missing tag postfix " << name);  // NOLINT
         }
     }
+    thaw();
     while (true) {
         if (overwrite) {
             erase(idx);
@@ -782,6 +785,7 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
+    thaw();
     auto it = this->mappedNames.find(name);
     if (it == this->mappedNames.end()) {
         return;
@@ -796,6 +800,7 @@ void ElementMap::erase(const MappedName& name)
 
 void ElementMap::erase(const IndexedName& idx)
 {
+    thaw();
     auto iter = this->indexedNames.find(idx.getType());
     if (iter == this->indexedNames.end()) {
         return;
@@ -813,18 +818,61 @@ void ElementMap::erase(const IndexedName& idx)
 
 unsigned long ElementMap::size() const
 {
-    return mappedNames.size() + childElementSize;
+    return mappedNames.size() + finalNames.size() + childElementSize;
 }
 
 bool ElementMap::empty() const
 {
-    return mappedNames.empty() && childElementSize == 0;
+    return mappedNames.empty() && finalNames.empty() && childElementSize == 0;
+}
+
+void ElementMap::finalize()
+{
+    if (mappedNames.empty()) {
+        return;
+    }
+    thaw();
+    // std::map is already sorted
+    finalNames.reserve(mappedNames.size());
+    for (auto& mappedName : mappedNames) {
+        finalNames.emplace_back(mappedName.first, mappedName.second);
+    }
+    mappedNames.clear();
+}
+
+void ElementMap::thaw()
+{
+    if (finalNames.empty()) {
+        return;
+    }
+    for (auto& finalName : finalNames) {
+        mappedNames.emplace_hint(mappedNames.end(), std::move(finalName.first), finalName.second);
+    }
+    finalNames.clear();
+    finalNames.shrink_to_fit();
+}
+
+const IndexedName* ElementMap::findName(const MappedName& name) const
+{
+    auto it = mappedNames.find(name);
+    if (it != mappedNames.end()) {
+        return &it->second;
+    }
+    auto iter = std::lower_bound(finalNames.begin(),
+                                 finalNames.end(),
+                                 name,
+                                 [](const std::pair<MappedName, IndexedName>& entry,
+                                    const MappedName& name) { return entry.first < name; });
+    if (iter != finalNames.end() && iter->first == name) {
+        return &iter->second;
+    }
+    return nullptr;
 }
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    const IndexedName* found = findName(name);
+    if (!found) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -861,7 +909,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(*found);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -874,7 +922,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return *found;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1080,6 +1128,9 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
     for (auto& mappedName : this->mappedNames) {
         addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
     }
+    for (auto& finalName : this->finalNames) {
+        addPostfix(finalName.first.constPostfix(), postfixMap, postfixes);
+    }
 
     childMaps.push_back(this);
     res.first->second = (int)childMaps.size();
@@ -1311,6 +1362,9 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    for (auto& finalName : this->finalNames) {
+        ret.emplace_back(finalName.first, finalName.second);
+    }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
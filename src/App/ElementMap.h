@@ -37,6 +37,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -150,6 +151,15 @@ public:
 
     unsigned long size() const;
 
+    /** Move the mapped names into compact sorted storage
+     *
+     * Call this once the map is fully constructed. Lookups then use a binary
+     * search over a flat array instead of a tree of heap allocated nodes.
+     * The map can still be modified afterwards, which moves the names back
+     * into the node based storage used while constructing the map.
+     */
+    void finalize();
+
     bool empty() const;
 
     IndexedName find(const MappedName& name, ElementIDRefs* sids = nullptr) const;
@@ -275,6 +285,12 @@ private:
     /// Reverse hashElementName()
     MappedName dehashElementName(const MappedName& name) const;
 
+    /// Move the mapped names out of the finalized storage for modification
+    void thaw();
+
+    /// Find the indexed name of a mapped name in either storage
+    const IndexedName* findName(const MappedName& name) const;
+
     // FIXME duplicate code? as in copy/paste
     const MappedNameRef* findMappedRef(const IndexedName& idx) const;
     MappedNameRef* findMappedRef(const IndexedName& idx);
@@ -305,6 +321,9 @@ private:
 
     std::map<MappedName, IndexedName, std::less<>> mappedNames;
 
+    /// Sorted mapped names of a finalized map, mappedNames is empty if not
+    std::vector<std::pair<MappedName, IndexedName>> finalNames;
+
     struct ChildMapInfo
     {
         int index = 0;
@@ -272,6 +272,21 @@ public:
 
     int priority() const override;
 
+    Expression* getCondition() const
+    {
+        return condition;
+    }
+
+    Expression* getTrueExpr() const
+    {
+        return trueExpr;
+    }
+
+    Expression* getFalseExpr() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -500,6 +515,8 @@ protected:
 
 protected:
     ObjectIdentifier var; /**< Variable name  */
+
+    friend class ExpressionProgram;
 };
 
 //////////////////////////////////////////////////////////////////////
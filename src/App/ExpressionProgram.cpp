@@ -0,0 +1,830 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+#include <Base/Quantity.h>
+
+#include "ExpressionProgram.h"
+#include "ExpressionParser.h"
+
+using namespace App;
+
+struct ExpressionProgram::Value
+{
+    enum Kind : unsigned char
+    {
+        Int,
+        Float,
+        Quantity,
+    };
+    Kind kind = Int;
+    long i = 0;
+    double f = 0.0;
+    Base::Quantity q;
+};
+
+namespace
+{
+
+using Value = ExpressionProgram::Value;
+
+// Maximum stack depth of a program, deeper expressions are not compiled
+constexpr int MaxStack = 16;
+
+constexpr long LongMin = std::numeric_limits<long>::min();
+constexpr long LongMax = std::numeric_limits<long>::max();
+
+Value makeInt(long v)
+{
+    Value res;
+    res.i = v;
+    return res;
+}
+
+Value makeFloat(double v)
+{
+    Value res;
+    res.kind = Value::Float;
+    res.f = v;
+    return res;
+}
+
+Value makeQuantity(const Base::Quantity& v)
+{
+    Value res;
+    res.kind = Value::Quantity;
+    res.q = v;
+    return res;
+}
+
+double toDouble(const Value& v)
+{
+    switch (v.kind) {
+        case Value::Int:
+            return static_cast<double>(v.i);
+        case Value::Float:
+            return v.f;
+        default:
+            return v.q.getValue();
+    }
+}
+
+// Same conversion as QuantityPy does for its number operands
+Base::Quantity toQuantity(const Value& v)
+{
+    if (v.kind == Value::Quantity) {
+        return v.q;
+    }
+    return Base::Quantity(toDouble(v));
+}
+
+bool isQuantity(const Value& a, const Value& b)
+{
+    return a.kind == Value::Quantity || b.kind == Value::Quantity;
+}
+
+bool isInt(const Value& a, const Value& b)
+{
+    return a.kind == Value::Int && b.kind == Value::Int;
+}
+
+// Check if an integer converts to double without rounding, which is when
+// Python compares and divides it as a double
+bool isExact(long v)
+{
+    constexpr long long limit = 1LL << std::numeric_limits<double>::digits;
+    return v >= -limit && v <= limit;
+}
+
+bool isTrue(const Value& v)
+{
+    return toDouble(v) != 0.0;
+}
+
+App::any toAny(const Value& v)
+{
+    switch (v.kind) {
+        case Value::Int:
+            return App::any(v.i);
+        case Value::Float:
+            return App::any(v.f);
+        default:
+            return App::any(v.q);
+    }
+}
+
+/* The following functions follow the Python semantics of the operators used
+ * by the expression tree. They return false where Python would either raise
+ * an exception or produce a value that is not representable here, e.g. an
+ * integer that does not fit into long.
+ */
+
+bool addInt(long a, long b, long& res)
+{
+    if ((b > 0 && a > LongMax - b) || (b < 0 && a < LongMin - b)) {
+        return false;
+    }
+    res = a + b;
+    return true;
+}
+
+bool subInt(long a, long b, long& res)
+{
+    if ((b < 0 && a > LongMax + b) || (b > 0 && a < LongMin + b)) {
+        return false;
+    }
+    res = a - b;
+    return true;
+}
+
+bool mulInt(long a, long b, long& res)
+{
+    if (a > 0) {
+        if (b > 0 ? a > LongMax / b : b < LongMin / a) {
+            return false;
+        }
+    }
+    else if (b > 0 ? a < LongMin / b : (a != 0 && b < LongMax / a)) {
+        return false;
+    }
+    res = a * b;
+    return true;
+}
+
+bool powInt(long base, long exp, long& res)
+{
+    res = 1;
+    while (exp) {
+        if ((exp & 1) && !mulInt(res, base, res)) {
+            return false;
+        }
+        exp >>= 1;
+        if (exp && !mulInt(base, base, base)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool modInt(long a, long b, long& res)
+{
+    if (b == 0) {
+        return false;
+    }
+    if (b == -1) {
+        res = 0;
+        return true;
+    }
+    res = a % b;
+    if (res != 0 && ((res < 0) != (b < 0))) {
+        res += b;
+    }
+    return true;
+}
+
+bool modFloat(double a, double b, double& res)
+{
+    if (b == 0.0) {
+        return false;
+    }
+    res = std::fmod(a, b);
+    if (res != 0.0) {
+        if ((b < 0) != (res < 0)) {
+            res += b;
+        }
+    }
+    else {
+        res = std::copysign(0.0, b);
+    }
+    return true;
+}
+
+bool powFloat(double a, double b, double& res)
+{
+    if (b == 0.0) {
+        res = 1.0;
+        return true;
+    }
+    if (!std::isfinite(a) || !std::isfinite(b)) {
+        return false;
+    }
+    if (a == 0.0 && b < 0.0) {
+        return false;
+    }
+    if (a < 0.0 && b != std::floor(b)) {
+        // Python returns a complex number
+        return false;
+    }
+    res = std::pow(a, b);
+    return std::isfinite(res);
+}
+
+bool addValues(const Value& a, const Value& b, Value& res)
+{
+    if (isQuantity(a, b)) {
+        res = makeQuantity(toQuantity(a) + toQuantity(b));
+        return true;
+    }
+    if (isInt(a, b)) {
+        long v {};
+        if (!addInt(a.i, b.i, v)) {
+            return false;
+        }
+        res = makeInt(v);
+        return true;
+    }
+    res = makeFloat(toDouble(a) + toDouble(b));
+    return true;
+}
+
+bool subValues(const Value& a, const Value& b, Value& res)
+{
+    if (isQuantity(a, b)) {
+        res = makeQuantity(toQuantity(a) - toQuantity(b));
+        return true;
+    }
+    if (isInt(a, b)) {
+        long v {};
+        if (!subInt(a.i, b.i, v)) {
+            return false;
+        }
+        res = makeInt(v);
+        return true;
+    }
+    res = makeFloat(toDouble(a) - toDouble(b));
+    return true;
+}
+
+bool mulValues(const Value& a, const Value& b, Value& res)
+{
+    if (isQuantity(a, b)) {
+        res = makeQuantity(toQuantity(a) * toQuantity(b));
+        return true;
+    }
+    if (isInt(a, b)) {
+        long v {};
+        if (!mulInt(a.i, b.i, v)) {
+            return false;
+        }
+        res = makeInt(v);
+        return true;
+    }
+    res = makeFloat(toDouble(a) * toDouble(b));
+    return true;
+}
+
+bool divValues(const Value& a, const Value& b, Value& res)
+{
+    if (isQuantity(a, b)) {
+        res = makeQuantity(toQuantity(a) / toQuantity(b));
+        return true;
+    }
+    if (toDouble(b) == 0.0) {
+        return false;
+    }
+    if (isInt(a, b) && (!isExact(a.i) || !isExact(b.i))) {
+        return false;
+    }
+    res = makeFloat(toDouble(a) / toDouble(b));
+    return true;
+}
+
+bool modValues(const Value& a, const Value& b, Value& res)
+{
+    if (a.kind == Value::Quantity) {
+        double v {};
+        if (!modFloat(a.q.getValue(), toDouble(b), v)) {
+            return false;
+        }
+        res = makeQuantity(Base::Quantity(v, a.q.getUnit()));
+        return true;
+    }
+    if (b.kind == Value::Quantity) {
+        return false;
+    }
+    if (isInt(a, b)) {
+        long v {};
+        if (!modInt(a.i, b.i, v)) {
+            return false;
+        }
+        res = makeInt(v);
+        return true;
+    }
+    double v {};
+    if (!modFloat(toDouble(a), toDouble(b), v)) {
+        return false;
+    }
+    res = makeFloat(v);
+    return true;
+}
+
+bool powValues(const Value& a, const Value& b, Value& res)
+{
+    if (a.kind == Value::Quantity) {
+        if (b.kind == Value::Quantity) {
+            res = makeQuantity(a.q.pow(b.q));
+        }
+        else {
+            res = makeQuantity(a.q.pow(toDouble(b)));
+        }
+        return true;
+    }
+    if (b.kind == Value::Quantity) {
+        return false;
+    }
+    if (isInt(a, b) && b.i >= 0) {
+        long v {};
+        if (!powInt(a.i, b.i, v)) {
+            return false;
+        }
+        res = makeInt(v);
+        return true;
+    }
+    double v {};
+    if (!powFloat(toDouble(a), toDouble(b), v)) {
+        return false;
+    }
+    res = makeFloat(v);
+    return true;
+}
+
+enum class Compare
+{
+    Eq,
+    Neq,
+    Lt,
+    Gt,
+    Lte,
+    Gte,
+};
+
+template<typename T>
+bool compareNumbers(const T& a, const T& b, Compare op)
+{
+    switch (op) {
+        case Compare::Eq:
+            return a == b;
+        case Compare::Neq:
+            return a != b;
+        case Compare::Lt:
+            return a < b;
+        case Compare::Gt:
+            return a > b;
+        case Compare::Lte:
+            return a <= b;
+        default:
+            return a >= b;
+    }
+}
+
+bool compareValues(const Value& a, const Value& b, Compare op, Value& res)
+{
+    bool v {};
+    if (a.kind == Value::Quantity && b.kind == Value::Quantity) {
+        // Same as QuantityPy::richCompare()
+        switch (op) {
+            case Compare::Eq:
+                v = a.q == b.q;
+                break;
+            case Compare::Neq:
+                v = !(a.q == b.q);
+                break;
+            case Compare::Lt:
+                v = a.q < b.q;
+                break;
+            case Compare::Gt:
+                v = !(a.q < b.q) && !(a.q == b.q);
+                break;
+            case Compare::Lte:
+                v = a.q < b.q || a.q == b.q;
+                break;
+            default:
+                v = !(a.q < b.q);
+                break;
+        }
+    }
+    else if (isInt(a, b)) {
+        v = compareNumbers(a.i, b.i, op);
+    }
+    else {
+        if (!isQuantity(a, b) && ((a.kind == Value::Int && !isExact(a.i))
+                                  || (b.kind == Value::Int && !isExact(b.i)))) {
+            // Python compares large integers with floats exactly
+            return false;
+        }
+        v = compareNumbers(toDouble(a), toDouble(b), op);
+    }
+    res = makeInt(v ? 1 : 0);
+    return true;
+}
+
+// Convert a number the same way as pyFromQuantity() in Expression.cpp
+bool makeLiteral(const Base::Quantity& quantity, Value& res)
+{
+    if (!quantity.isDimensionless()) {
+        res = makeQuantity(quantity);
+        return true;
+    }
+    double v = quantity.getValue();
+    double intpart {};
+    if (std::modf(v, &intpart) == 0.0) {
+        if (intpart < 0.0 ? intpart >= static_cast<double>(LongMin)
+                          : intpart <= std::numeric_limits<int>::max()) {
+            res = makeInt(static_cast<long>(intpart));
+            return true;
+        }
+        if (intpart > 0.0 && intpart <= static_cast<double>(LongMax)) {
+            // pyFromQuantity() truncates these to int, leave it to the tree
+            return false;
+        }
+    }
+    res = makeFloat(v);
+    return true;
+}
+
+bool loadProperty(const Property& prop, Value& res)
+{
+    if (auto p = freecad_cast<const PropertyQuantity*>(&prop)) {
+        res = makeQuantity(Base::Quantity(p->getValue(), p->getUnit()));
+    }
+    else if (auto p = freecad_cast<const PropertyFloat*>(&prop)) {
+        res = makeFloat(p->getValue());
+    }
+    else if (auto p = freecad_cast<const PropertyInteger*>(&prop)) {
+        res = makeInt(p->getValue());
+    }
+    else if (auto p = freecad_cast<const PropertyBool*>(&prop)) {
+        res = makeInt(p->getValue() ? 1 : 0);
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+class ExpressionProgram::Compiler
+{
+public:
+    explicit Compiler(ExpressionProgram& program)
+        : program(program)
+    {}
+
+    // Emit the code of an expression, returns false if it is not supported
+    bool emit(const Expression* expr)
+    {
+        if (!expr || expr->hasComponent()) {
+            return false;
+        }
+
+        std::size_t begin = program.code.size();
+        std::size_t constants = program.constants.size();
+        Base::Type type = expr->getTypeId();
+
+        if (type == OperatorExpression::getClassTypeId()) {
+            auto e = static_cast<const OperatorExpression*>(expr);
+            if (!emitOperator(e)) {
+                return false;
+            }
+        }
+        else if (type == ConditionalExpression::getClassTypeId()) {
+            auto e = static_cast<const ConditionalExpression*>(expr);
+            if (!emit(e->getCondition())) {
+                return false;
+            }
+            std::size_t jumpFalse = add(OpCode::JumpIfFalse);
+            int branchDepth = depth;
+            if (!emit(e->getTrueExpr())) {
+                return false;
+            }
+            std::size_t jumpEnd = add(OpCode::Jump);
+            program.code[jumpFalse].arg = static_cast<int>(program.code.size());
+            depth = branchDepth;
+            if (!emit(e->getFalseExpr())) {
+                return false;
+            }
+            program.code[jumpEnd].arg = static_cast<int>(program.code.size());
+        }
+        else if (type == VariableExpression::getClassTypeId()) {
+            auto e = static_cast<const VariableExpression*>(expr);
+            add(OpCode::Load, static_cast<int>(program.variables.size()));
+            program.variables.push_back(e);
+            return true;
+        }
+        else if (type == ConstantExpression::getClassTypeId()) {
+            auto e = static_cast<const ConstantExpression*>(expr);
+            std::string name = e->getName();
+            if (name == "None") {
+                return false;
+            }
+            if (name == "True" || name == "False") {
+                return push(makeInt(name == "True" ? 1 : 0));
+            }
+            Value v;
+            return makeLiteral(e->getQuantity(), v) && push(v);
+        }
+        else if (type == NumberExpression::getClassTypeId()
+                 || type == UnitExpression::getClassTypeId()) {
+            auto e = static_cast<const UnitExpression*>(expr);
+            Value v;
+            return makeLiteral(e->getQuantity(), v) && push(v);
+        }
+        else {
+            return false;
+        }
+
+        fold(begin, constants);
+        return true;
+    }
+
+    bool finish()
+    {
+        return maxDepth <= MaxStack;
+    }
+
+private:
+    bool emitOperator(const OperatorExpression* expr)
+    {
+        OpCode op {};
+        switch (expr->getOperator()) {
+            case OperatorExpression::NEG:
+            case OperatorExpression::POS:
+                if (!emit(expr->getLeft())) {
+                    return false;
+                }
+                add(expr->getOperator() == OperatorExpression::NEG ? OpCode::Neg : OpCode::Pos);
+                return true;
+            case OperatorExpression::ADD:
+                op = OpCode::Add;
+                break;
+            case OperatorExpression::SUB:
+                op = OpCode::Sub;
+                break;
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                op = OpCode::Mul;
+                break;
+            case OperatorExpression::DIV:
+                op = OpCode::Div;
+                break;
+            case OperatorExpression::MOD:
+                op = OpCode::Mod;
+                break;
+            case OperatorExpression::POW:
+                op = OpCode::Pow;
+                break;
+            case OperatorExpression::EQ:
+                op = OpCode::Eq;
+                break;
+            case OperatorExpression::NEQ:
+                op = OpCode::Neq;
+                break;
+            case OperatorExpression::LT:
+                op = OpCode::Lt;
+                break;
+            case OperatorExpression::GT:
+                op = OpCode::Gt;
+                break;
+            case OperatorExpression::LTE:
+                op = OpCode::Lte;
+                break;
+            case OperatorExpression::GTE:
+                op = OpCode::Gte;
+                break;
+            default:
+                return false;
+        }
+        if (!emit(expr->getLeft()) || !emit(expr->getRight())) {
+            return false;
+        }
+        add(op);
+        return true;
+    }
+
+    std::size_t add(OpCode op, int arg = 0)
+    {
+        switch (op) {
+            case OpCode::Push:
+            case OpCode::Load:
+                ++depth;
+                maxDepth = std::max(depth, maxDepth);
+                break;
+            case OpCode::Neg:
+            case OpCode::Pos:
+            case OpCode::Jump:
+                break;
+            default:
+                --depth;
+                break;
+        }
+        program.code.push_back({op, arg});
+        return program.code.size() - 1;
+    }
+
+    bool push(const Value& v)
+    {
+        add(OpCode::Push, static_cast<int>(program.constants.size()));
+        program.constants.push_back(v);
+        return true;
+    }
+
+    // Replace the code of a sub-expression without any variable by its value.
+    // Failure to evaluate is left for run time, because the sub-expression
+    // may be in a branch that is never taken.
+    void fold(std::size_t begin, std::size_t constants)
+    {
+        auto& code = program.code;
+        if (code.size() - begin < 2) {
+            return;
+        }
+        for (std::size_t i = begin; i < code.size(); ++i) {
+            if (code[i].op == OpCode::Load) {
+                return;
+            }
+        }
+        std::array<Value, MaxStack> stack;
+        int top = 0;
+        try {
+            if (maxDepth > MaxStack || !program.run(begin, code.size(), stack.data(), top)) {
+                return;
+            }
+        }
+        catch (Base::Exception&) {
+            return;
+        }
+        code.resize(begin);
+        program.constants.resize(constants);
+        --depth;
+        push(stack[0]);
+    }
+
+    ExpressionProgram& program;
+    int depth = 0;
+    int maxDepth = 0;
+};
+
+ExpressionProgram::~ExpressionProgram() = default;
+
+std::shared_ptr<const ExpressionProgram>
+ExpressionProgram::compile(std::shared_ptr<const Expression> expr)
+{
+    // Not using make_shared because of the private constructor
+    std::shared_ptr<ExpressionProgram> program(new ExpressionProgram);
+    Compiler compiler(*program);
+    if (!compiler.emit(expr.get()) || !compiler.finish()) {
+        program->code.clear();
+        program->constants.clear();
+        program->variables.clear();
+    }
+    program->expression = std::move(expr);
+    return program;
+}
+
+bool ExpressionProgram::run(std::size_t begin, std::size_t end, Value* stack, int& top) const
+{
+    for (std::size_t pc = begin; pc < end; ++pc) {
+        const Instruction& ins = code[pc];
+        switch (ins.op) {
+            case OpCode::Push:
+                stack[top++] = constants[ins.arg];
+                continue;
+            case OpCode::Load: {
+                const ObjectIdentifier& path = variables[ins.arg]->var;
+                int ptype = 0;
+                auto prop = path.getProperty(&ptype);
+                // Pseudo properties and sub paths are left to the tree
+                if (!prop || ptype != 0 || path.numSubComponents() != 1
+                    || !loadProperty(*prop, stack[top])) {
+                    return false;
+                }
+                ++top;
+                continue;
+            }
+            case OpCode::Neg: {
+                Value& v = stack[top - 1];
+                if (v.kind == Value::Quantity) {
+                    v.q = v.q * -1.0;
+                }
+                else if (v.kind == Value::Float) {
+                    v.f = -v.f;
+                }
+                else if (v.i == LongMin) {
+                    return false;
+                }
+                else {
+                    v.i = -v.i;
+                }
+                continue;
+            }
+            case OpCode::Pos:
+                continue;
+            case OpCode::JumpIfFalse:
+                if (!isTrue(stack[--top])) {
+                    pc = static_cast<std::size_t>(ins.arg) - 1;
+                }
+                continue;
+            case OpCode::Jump:
+                pc = static_cast<std::size_t>(ins.arg) - 1;
+                continue;
+            default:
+                break;
+        }
+
+        const Value& a = stack[top - 2];
+        const Value& b = stack[top - 1];
+        Value res;
+        bool ok = false;
+        switch (ins.op) {
+            case OpCode::Add:
+                ok = addValues(a, b, res);
+                break;
+            case OpCode::Sub:
+                ok = subValues(a, b, res);
+                break;
+            case OpCode::Mul:
+                ok = mulValues(a, b, res);
+                break;
+            case OpCode::Div:
+                ok = divValues(a, b, res);
+                break;
+            case OpCode::Mod:
+                ok = modValues(a, b, res);
+                break;
+            case OpCode::Pow:
+                ok = powValues(a, b, res);
+                break;
+            case OpCode::Eq:
+                ok = compareValues(a, b, Compare::Eq, res);
+                break;
+            case OpCode::Neq:
+                ok = compareValues(a, b, Compare::Neq, res);
+                break;
+            case OpCode::Lt:
+                ok = compareValues(a, b, Compare::Lt, res);
+                break;
+            case OpCode::Gt:
+                ok = compareValues(a, b, Compare::Gt, res);
+                break;
+            case OpCode::Lte:
+                ok = compareValues(a, b, Compare::Lte, res);
+                break;
+            case OpCode::Gte:
+                ok = compareValues(a, b, Compare::Gte, res);
+                break;
+            default:
+                break;
+        }
+        if (!ok) {
+            return false;
+        }
+        --top;
+        stack[top - 1] = res;
+    }
+    return true;
+}
+
+bool ExpressionProgram::eval(App::any& value) const
+{
+    if (code.empty()) {
+        return false;
+    }
+    std::array<Value, MaxStack> stack;
+    int top = 0;
+    try {
+        if (!run(0, code.size(), stack.data(), top)) {
+            return false;
+        }
+    }
+    catch (Base::Exception&) {
+        return false;
+    }
+    value = toAny(stack[0]);
+    return true;
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_EXPRESSIONPROGRAM_H
+#define APP_EXPRESSIONPROGRAM_H
+
+#include <memory>
+#include <vector>
+
+#include "Expression.h"
+
+namespace App
+{
+
+class VariableExpression;
+
+/** A numeric expression compiled to a compact stack machine program
+ *
+ * Expression::getValueAsAny() walks the expression tree and evaluates each
+ * node through a Python object. For the common case of an arithmetic or
+ * conditional expression over numbers, quantities and numeric properties, the
+ * program produces the same value without creating any Python object.
+ *
+ * Constant sub-expressions, including their unit checks, are folded when
+ * compiling. Expressions using functions, strings, components or any other
+ * unsupported construct are not compiled, and the program also gives up at
+ * evaluation time whenever the result would differ from the Python semantics,
+ * e.g. on integer overflow or a unit mismatch. In both cases the caller is
+ * expected to evaluate the expression tree, which also takes care of
+ * reporting errors.
+ */
+class AppExport ExpressionProgram
+{
+public:
+    /** Compile an expression
+     *
+     * @param expr: the expression to compile. The program keeps a reference
+     * to it, because it reads the variables straight from the tree.
+     *
+     * @return Returns the program. Check isValid() for whether the expression
+     * is supported.
+     */
+    static std::shared_ptr<const ExpressionProgram> compile(std::shared_ptr<const Expression> expr);
+
+    ~ExpressionProgram();
+
+    /// Return the expression this program is compiled from
+    const Expression* getExpression() const
+    {
+        return expression.get();
+    }
+
+    /// Check whether the expression is supported
+    bool isValid() const
+    {
+        return !code.empty();
+    }
+
+    /** Evaluate the program
+     *
+     * @param value: returns the value in the same form as
+     * Expression::getValueAsAny()
+     *
+     * @return Returns false if the program cannot produce the value, in which
+     * case the caller shall evaluate the expression tree instead.
+     */
+    bool eval(App::any& value) const;
+
+    struct Value;
+
+private:
+    ExpressionProgram() = default;
+
+    enum class OpCode : unsigned char
+    {
+        Push,
+        Load,
+        Neg,
+        Pos,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Mod,
+        Pow,
+        Eq,
+        Neq,
+        Lt,
+        Gt,
+        Lte,
+        Gte,
+        JumpIfFalse,
+        Jump,
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        int arg;
+    };
+
+    class Compiler;
+
+    bool run(std::size_t begin, std::size_t end, Value* stack, int& top) const;
+
+    std::shared_ptr<const Expression> expression;
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::vector<const VariableExpression*> variables;
+};
+
+}  // namespace App
+
+#endif  // APP_EXPRESSIONPROGRAM_H
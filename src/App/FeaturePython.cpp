@@ -32,6 +32,7 @@
 
 #include "FeaturePython.h"
 #include "FeaturePythonPyImp.h"
+#include "RecomputeProfiler.h"
 
 
 using namespace App;
@@ -74,6 +75,7 @@ void FeaturePythonImp::init(PyObject* pyobj)
 bool FeaturePythonImp::execute()
 {
     FC_PY_CALL_CHECK(execute)
+    RecomputeProfiler::Scope profile("execute", RecomputeProfiler::Category::Python, object);
     Base::PyGILStateLocker lock;
     try {
         if (has__object__) {
@@ -25,6 +25,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <sstream>
+#include <thread>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
@@ -241,6 +242,27 @@ DocumentObjectExecReturn* FeatureTestException::execute()
 
 // ----------------------------------------------------------------------------
 
+PROPERTY_SOURCE(App::FeatureTestThreadSafe, App::FeatureTest)
+
+
+FeatureTestThreadSafe::FeatureTestThreadSafe()
+{
+    ADD_PROPERTY_TYPE(ExecThread, (""), "Test", App::Prop_Output, "");
+}
+
+DocumentObjectExecReturn* FeatureTestThreadSafe::execute()
+{
+    if (ExceptionType.getValue() == 3) {
+        throw Base::AbortException("FeatureTestThreadSafe::execute(): Abort");
+    }
+    std::ostringstream str;
+    str << std::this_thread::get_id();
+    ExecThread.setValue(str.str());
+    return FeatureTest::execute();
+}
+
+// ----------------------------------------------------------------------------
+
 PROPERTY_SOURCE(App::FeatureTestColumn, App::DocumentObject)
 
 
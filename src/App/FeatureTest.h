@@ -140,6 +140,25 @@ public:
     }
 };
 
+/// The testing feature that is recomputed on a worker thread by a parallel recompute
+class FeatureTestThreadSafe: public FeatureTest
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(App::FeatureTestThreadSafe);
+
+public:
+    FeatureTestThreadSafe();
+
+    /// The id of the thread of the last execution
+    App::PropertyString ExecThread;
+
+    /// recalculate the Feature, an ExceptionType of 3 aborts the recompute
+    DocumentObjectExecReturn* execute() override;
+    bool isRecomputeThreadSafe() const override
+    {
+        return true;
+    }
+};
+
 class FeatureTestColumn: public DocumentObject
 {
     PROPERTY_HEADER_WITH_OVERRIDE(App::FeatureTestColumn);
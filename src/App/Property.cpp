@@ -48,6 +48,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::Property, Base::Persistence)
 // Construction/Destruction
 
 static std::atomic<int64_t> _PropID;
+static std::atomic<int64_t> _PropRevision;
 
 // Here is the implementation! Description should take place in the header file!
 Property::Property()
@@ -267,9 +268,15 @@ bool Property::isNotifyEnabled() const
     return !StatusBits.test(DisableNotify);
 }
 
+int64_t Property::getLatestRevision()
+{
+    return _PropRevision;
+}
+
 void Property::touch()
 {
     PropertyCleaner guard(this);
+    _revision = ++_PropRevision;
     if (father && isNotifyEnabled()) {
         father->onEarlyChange(this);
         father->onChanged(this);
@@ -285,6 +292,7 @@ void Property::setReadOnly(bool readOnly)
 void Property::hasSetValue()
 {
     PropertyCleaner guard(this);
+    _revision = ++_PropRevision;
     if (father) {
         if (isNotifyEnabled()) {
             father->onChanged(this);
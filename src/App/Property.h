@@ -525,6 +525,22 @@ public:
         return _id;
     }
 
+    /**
+     * @brief Return the revision of the property value.
+     *
+     * The revision is taken from a monotonically increasing internal counter
+     * each time the property is changed or touched.  It allows to check
+     * whether the value has changed since the revision was last seen,
+     * without keeping a copy of the value.
+     */
+    int64_t getRevision() const
+    {
+        return _revision;
+    }
+
+    /// Return the revision of the latest change of any property
+    static int64_t getLatestRevision();
+
     /**
      * @brief Callback for when the property is about to be saved.
      *
@@ -605,6 +621,7 @@ private:
     PropertyContainer* father {nullptr};
     const char* myName {nullptr};
     int64_t _id;
+    int64_t _revision {0};
 
 public:
     /// Signal emitted when the property value has changed.
@@ -27,12 +27,14 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/DocumentObserver.h>
+#include <App/PropertyPythonObject.h>
 #include <Base/Reader.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "ExpressionProgram.h"
 #include "ExpressionVisitors.h"
 
 
@@ -95,6 +97,63 @@ struct PropertyExpressionEngine::Private
     std::unordered_map<std::string, std::vector<ObjectIdentifier>> propMap;
 };
 
+static App::any evaluate(PropertyExpressionEngine::ExpressionInfo& info)
+{
+    // The expression tree may be replaced without resetting the program, so
+    // check the program against the tree it is compiled from
+    if (!info.program || info.program->getExpression() != info.expression.get()) {
+        info.program = ExpressionProgram::compile(info.expression);
+    }
+    App::any value;
+    if (!info.program->eval(value)) {
+        value = info.expression->getValueAsAny();
+    }
+    return value;
+}
+
+// Check whether the bound property and all inputs of an expression are
+// unchanged since the expression was last evaluated
+static bool isUpToDate(const PropertyExpressionEngine::ExpressionInfo& info, const Property& prop)
+{
+    if (!info.tracked || !info.program || info.program->getExpression() != info.expression.get()
+        || info.revision != prop.getRevision()) {
+        return false;
+    }
+    for (const auto& input : info.inputs) {
+        auto inputProp = input.path.getProperty();
+        if (!inputProp || inputProp->getID() != input.id
+            || inputProp->getRevision() != input.revision) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Record the inputs of an expression about to be evaluated. Pseudo
+// properties, and sub paths through a link or a Python object, may change
+// without any change of the property being read, so expressions using them
+// are not tracked.
+static bool trackInputs(PropertyExpressionEngine::ExpressionInfo& info)
+{
+    info.tracked = false;
+    info.inputs.clear();
+    for (auto& v : info.expression->getIdentifiers()) {
+        const ObjectIdentifier& path = v.first;
+        int ptype = 0;
+        auto inputProp = path.getProperty(&ptype);
+        if (!inputProp || ptype != 0) {
+            return false;
+        }
+        if (path.numSubComponents() > 1
+            && (inputProp->isDerivedFrom<PropertyLinkBase>()
+                || inputProp->isDerivedFrom<PropertyPythonObject>())) {
+            return false;
+        }
+        info.inputs.push_back({path, inputProp->getID(), inputProp->getRevision()});
+    }
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 
 TYPESYSTEM_SOURCE(App::PropertyExpressionEngine, App::PropertyExpressionContainer)
@@ -145,6 +204,11 @@ Property* PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    // The expressions may have been modified in place, e.g. on relabel
+    for (auto& e : expressions) {
+        e.second.tracked = false;
+    }
+
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
@@ -250,7 +314,7 @@ void PropertyExpressionEngine::updateHiddenReference(const std::string& key)
         Base::StateLocker guard(it->second.busy);
         App::any value;
         try {
-            value = it->second.expression->getValueAsAny();
+            value = evaluate(it->second);
             if (!isAnyEqual(value, myProp->getPathValue(var))) {
                 myProp->setPathValue(var, value);
             }
@@ -760,9 +824,14 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
-            if (expression) {
-                value = expression->getValueAsAny();
+            ExpressionInfo& info = expressions[*it];
+            if (info.expression) {
+                // Skip the expression if none of its inputs has changed
+                if (option != ExecuteOnRestore && isUpToDate(info, *prop)) {
+                    continue;
+                }
+                bool tracked = trackInputs(info);
+                value = evaluate(info);
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -778,6 +847,8 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 // if (option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore))
                 {
                     if (isAnyEqual(value, prop->getPathValue(*it))) {
+                        info.revision = prop->getRevision();
+                        info.tracked = tracked;
                         continue;
                     }
                     if (touched) {
@@ -785,6 +856,8 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                     }
                 }
                 prop->setPathValue(*it, value);
+                info.revision = prop->getRevision();
+                info.tracked = tracked;
             }
         }
         catch (Base::Exception& e) {
@@ -51,6 +51,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class ExpressionProgram;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer: public App::PropertyXLinkContainer
@@ -103,8 +104,25 @@ public:
     struct ExpressionInfo
     {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        /** The compiled expression, recompiled on evaluation if it does not
+         * match the expression tree */
+        std::shared_ptr<const App::ExpressionProgram> program;
         bool busy;
 
+        /// A property read by the expression, see Property::getRevision()
+        struct Input
+        {
+            App::ObjectIdentifier path;
+            int64_t id;
+            int64_t revision;
+        };
+        /** The inputs of the expression when it was last evaluated, only
+         * valid if tracked is true */
+        std::vector<Input> inputs;
+        /// Revision of the bound property when the expression was last evaluated
+        int64_t revision {0};
+        bool tracked {false};
+
         explicit ExpressionInfo(
             std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>())
         {
@@ -1333,6 +1333,11 @@ bool PropertyComplexGeoData::checkElementMapVersion(const char* ver) const
     return data->checkElementMapVersion(ver + 2);
 }
 
+bool PropertyComplexGeoData::isCopyOwningData() const
+{
+    return false;
+}
+
 
 void PropertyComplexGeoData::afterRestore()
 {
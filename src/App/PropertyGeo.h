@@ -575,6 +575,14 @@ public:
     /// Return true to signal element map version change
     virtual bool checkElementMapVersion(const char* ver) const;
 
+    /** Check whether the copy returned by Copy() owns its geometry
+     *
+     * Transactions only write such copies to their spill file, because
+     * releasing a copy that shares its geometry with the original would not
+     * free any memory.
+     */
+    virtual bool isCopyOwningData() const;
+
     void afterRestore() override;
 };
 
@@ -827,8 +827,23 @@ long PropertyIntegerList::getPyValue(PyObject* item) const
     throw Base::TypeError(error);
 }
 
+namespace
+{
+// Integer lists are written as binary file if requested by the "BinaryLists" mode of the
+// writer. Very short lists are kept inline as they are cheaper than an extra file.
+bool saveBinaryList(const Base::Writer& writer, std::size_t size)
+{
+    return size >= 16 && !writer.isForceXML() && writer.getMode("BinaryLists");
+}
+}  // namespace
+
 void PropertyIntegerList::Save(Base::Writer& writer) const
 {
+    if (saveBinaryList(writer, _lValueList.size())) {
+        writer.Stream() << writer.ind() << "<IntegerList file=\"" << writer.addFile(getName(), this)
+                        << "\"/>" << endl;
+        return;
+    }
     writer.Stream() << writer.ind() << "<IntegerList count=\"" << getSize() << "\">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
@@ -842,6 +857,11 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
 {
     // read my Element
     reader.readElement("IntegerList");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute<const char*>("file"));
+        reader.addFile(file.c_str(), this);
+        return;
+    }
     // get the value of my Attribute
     int count = reader.getAttribute<long>("count");
 
@@ -857,6 +877,29 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
     setValues(values);
 }
 
+void PropertyIntegerList::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    str << static_cast<uint32_t>(_lValueList.size());
+    for (long it : _lValueList) {
+        str << static_cast<int64_t>(it);
+    }
+}
+
+void PropertyIntegerList::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t uCt = 0;
+    str >> uCt;
+    std::vector<long> values(uCt);
+    for (long& it : values) {
+        int64_t val = 0;
+        str >> val;
+        it = static_cast<long>(val);
+    }
+    setValues(values);
+}
+
 Property* PropertyIntegerList::Copy() const
 {
     PropertyIntegerList* p = new PropertyIntegerList();
@@ -950,6 +993,11 @@ void PropertyIntegerSet::setPyObject(PyObject* value)
 
 void PropertyIntegerSet::Save(Base::Writer& writer) const
 {
+    if (saveBinaryList(writer, _lValueSet.size())) {
+        writer.Stream() << writer.ind() << "<IntegerSet file=\"" << writer.addFile(getName(), this)
+                        << "\"/>" << endl;
+        return;
+    }
     writer.Stream() << writer.ind() << "<IntegerSet count=\"" << _lValueSet.size() << "\">" << endl;
     writer.incInd();
     for (long it : _lValueSet) {
@@ -963,6 +1011,11 @@ void PropertyIntegerSet::Restore(Base::XMLReader& reader)
 {
     // read my Element
     reader.readElement("IntegerSet");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute<const char*>("file"));
+        reader.addFile(file.c_str(), this);
+        return;
+    }
     // get the value of my Attribute
     int count = reader.getAttribute<long>("count");
 
@@ -978,6 +1031,29 @@ void PropertyIntegerSet::Restore(Base::XMLReader& reader)
     setValues(values);
 }
 
+void PropertyIntegerSet::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    str << static_cast<uint32_t>(_lValueSet.size());
+    for (long it : _lValueSet) {
+        str << static_cast<int64_t>(it);
+    }
+}
+
+void PropertyIntegerSet::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t uCt = 0;
+    str >> uCt;
+    std::set<long> values;
+    for (uint32_t i = 0; i < uCt; i++) {
+        int64_t val = 0;
+        str >> val;
+        values.insert(values.end(), static_cast<long>(val));
+    }
+    setValues(values);
+}
+
 Property* PropertyIntegerSet::Copy() const
 {
     PropertyIntegerSet* p = new PropertyIntegerSet();
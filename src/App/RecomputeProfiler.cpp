@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+
+#include "DocumentObject.h"
+#include "RecomputeProfiler.h"
+
+using namespace App;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Frame
+{
+    RecomputeProfiler::Node node;
+    Clock::time_point begin;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::vector<Frame> frames;
+std::atomic<int> threadCount {0};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int threadIndex()
+{
+    thread_local int index = ++threadCount;
+    return index;
+}
+
+const char* categoryName(RecomputeProfiler::Category category)
+{
+    switch (category) {
+        case RecomputeProfiler::Category::Document:
+            return "document";
+        case RecomputeProfiler::Category::Feature:
+            return "feature";
+        case RecomputeProfiler::Category::Python:
+            return "python";
+        case RecomputeProfiler::Category::Kernel:
+            return "kernel";
+        default:
+            return "other";
+    }
+}
+
+double categoryTime(const RecomputeProfiler::Node& node, RecomputeProfiler::Category category)
+{
+    return node.times[static_cast<std::size_t>(category)];
+}
+
+void writeString(std::ostream& stream, const std::string& str)
+{
+    stream << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            case '\n':
+                stream << "\\n";
+                break;
+            case '\t':
+                stream << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                           << static_cast<int>(c) << std::dec << std::setfill(' ');
+                }
+                else {
+                    stream << c;
+                }
+                break;
+        }
+    }
+    stream << '"';
+}
+
+void writeTimes(std::ostream& stream, const RecomputeProfiler::Node& node)
+{
+    double childTime = 0.0;
+    for (const auto& child : node.children) {
+        childTime += child.duration;
+    }
+    stream << "\"duration\":" << node.duration << ",\"self\":" << node.duration - childTime
+           << ",\"python\":" << categoryTime(node, RecomputeProfiler::Category::Python)
+           << ",\"kernel\":" << categoryTime(node, RecomputeProfiler::Category::Kernel);
+}
+
+void writeNode(std::ostream& stream, const RecomputeProfiler::Node& node)
+{
+    stream << "{\"name\":";
+    writeString(stream, node.name);
+    if (!node.object.empty()) {
+        stream << ",\"object\":";
+        writeString(stream, node.object);
+    }
+    stream << ",\"category\":\"" << categoryName(node.category) << "\",\"thread\":" << node.thread
+           << ",\"start\":" << node.start << ',';
+    writeTimes(stream, node);
+    if (!node.children.empty()) {
+        stream << ",\"children\":[";
+        bool first = true;
+        for (const auto& child : node.children) {
+            if (!first) {
+                stream << ',';
+            }
+            first = false;
+            writeNode(stream, child);
+        }
+        stream << ']';
+    }
+    stream << '}';
+}
+
+struct ObjectSummary
+{
+    int count = 0;
+    double duration = 0.0;
+    double python = 0.0;
+    double kernel = 0.0;
+};
+
+void summarize(const RecomputeProfiler::Node& node, std::map<std::string, ObjectSummary>& summary)
+{
+    if (node.category == RecomputeProfiler::Category::Feature && !node.object.empty()) {
+        auto& entry = summary[node.object];
+        ++entry.count;
+        entry.duration += node.duration;
+        entry.python += categoryTime(node, RecomputeProfiler::Category::Python);
+        entry.kernel += categoryTime(node, RecomputeProfiler::Category::Kernel);
+        // A feature recomputed inside another one, e.g. by a recursive
+        // recompute, is already accounted for by its parent.
+        return;
+    }
+    for (const auto& child : node.children) {
+        summarize(child, summary);
+    }
+}
+
+void writeJson(std::ostream& stream, const std::vector<RecomputeProfiler::Node>& nodes)
+{
+    stream << "{\"calls\":[";
+    bool first = true;
+    std::map<std::string, ObjectSummary> summary;
+    for (const auto& node : nodes) {
+        if (!first) {
+            stream << ',';
+        }
+        first = false;
+        writeNode(stream, node);
+        summarize(node, summary);
+    }
+
+    // List the objects with the slowest first
+    std::vector<std::pair<std::string, ObjectSummary>> objects(summary.begin(), summary.end());
+    std::stable_sort(objects.begin(), objects.end(), [](const auto& a, const auto& b) {
+        return a.second.duration > b.second.duration;
+    });
+    stream << "],\"objects\":[";
+    first = true;
+    for (const auto& [name, entry] : objects) {
+        if (!first) {
+            stream << ',';
+        }
+        first = false;
+        stream << "{\"object\":";
+        writeString(stream, name);
+        stream << ",\"count\":" << entry.count << ",\"duration\":" << entry.duration
+               << ",\"python\":" << entry.python << ",\"kernel\":" << entry.kernel << '}';
+    }
+    stream << "]}";
+}
+
+void writeTraceEvents(std::ostream& stream, const RecomputeProfiler::Node& node, bool& first)
+{
+    if (!first) {
+        stream << ',';
+    }
+    first = false;
+    stream << "{\"name\":";
+    writeString(stream, node.object.empty() ? node.name : node.name + " " + node.object);
+    stream << ",\"cat\":\"" << categoryName(node.category) << "\",\"ph\":\"X\",\"ts\":"
+           << node.start << ",\"dur\":" << node.duration << ",\"pid\":0,\"tid\":" << node.thread
+           << ",\"args\":{";
+    writeTimes(stream, node);
+    stream << "}}";
+    for (const auto& child : node.children) {
+        writeTraceEvents(stream, child, first);
+    }
+}
+
+void writeChromeTrace(std::ostream& stream, const std::vector<RecomputeProfiler::Node>& nodes)
+{
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& node : nodes) {
+        writeTraceEvents(stream, node, first);
+    }
+    stream << "]}";
+}
+
+}  // namespace
+
+RecomputeProfiler::RecomputeProfiler()
+    : epoch(Clock::now().time_since_epoch().count())
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    enabled = hGrp->GetBool("RecomputeProfiler", false);
+}
+
+RecomputeProfiler& RecomputeProfiler::instance()
+{
+    static RecomputeProfiler profiler;
+    return profiler;
+}
+
+void RecomputeProfiler::setEnabled(bool enable)
+{
+    enabled = enable;
+}
+
+void RecomputeProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    nodes.clear();
+    epoch = Clock::now().time_since_epoch().count();
+}
+
+std::vector<RecomputeProfiler::Node> RecomputeProfiler::getNodes() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return nodes;
+}
+
+std::string RecomputeProfiler::dump(Format format) const
+{
+    std::vector<Node> calls = getNodes();
+    std::stable_sort(calls.begin(), calls.end(), [](const Node& a, const Node& b) {
+        return a.start < b.start;
+    });
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    if (format == Format::ChromeTrace) {
+        writeChromeTrace(stream, calls);
+    }
+    else {
+        writeJson(stream, calls);
+    }
+    return stream.str();
+}
+
+void RecomputeProfiler::push(const char* name, Category category, const DocumentObject* object)
+{
+    Frame frame;
+    frame.node.name = name ? name : "";
+    if (object) {
+        frame.node.object = object->getFullName();
+    }
+    frame.node.category = category;
+    frame.node.thread = threadIndex();
+    frame.begin = Clock::now();
+    frame.node.start = std::chrono::duration<double, std::micro>(
+                           frame.begin - Clock::time_point(Clock::duration(epoch.load()))
+    )
+                           .count();
+    frames.push_back(std::move(frame));
+}
+
+void RecomputeProfiler::pop()
+{
+    if (frames.empty()) {
+        return;
+    }
+    Frame frame = std::move(frames.back());
+    frames.pop_back();
+
+    Node& node = frame.node;
+    node.duration =
+        std::chrono::duration<double, std::micro>(Clock::now() - frame.begin).count();
+    double selfTime = node.duration;
+    for (const auto& child : node.children) {
+        selfTime -= child.duration;
+        for (std::size_t i = 0; i < CategoryCount; ++i) {
+            node.times[i] += child.times[i];
+        }
+    }
+    node.times[static_cast<std::size_t>(node.category)] += std::max(0.0, selfTime);
+
+    if (!frames.empty()) {
+        frames.back().node.children.push_back(std::move(node));
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    nodes.push_back(std::move(node));
+}
+
+RecomputeProfiler::Scope::Scope(const char* name, Category category, const DocumentObject* object)
+    : active(RecomputeProfiler::instance().isEnabled())
+{
+    if (active) {
+        RecomputeProfiler::instance().push(name, category, object);
+    }
+}
+
+RecomputeProfiler::Scope::~Scope()
+{
+    if (active) {
+        RecomputeProfiler::instance().pop();
+    }
+}
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_RECOMPUTEPROFILER_H
+#define APP_RECOMPUTEPROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/** A hierarchical profiler for document recomputation
+ *
+ * Unlike the Tracy zones in Base/Profiler.h, the profiler is always compiled
+ * in and can be switched on at runtime, e.g. from Python with
+ * FreeCAD.setRecomputeProfiling(True). When disabled, a Scope costs a single
+ * atomic load.
+ *
+ * Scopes nest per thread. Each recorded call keeps its wall time and its time
+ * split by category, where the time of a scope not covered by its child scopes
+ * is attributed to the category of the scope itself. So the kernel time of a
+ * feature is the time spent in the kernel scopes below it, and the Python time
+ * excludes any kernel call made from Python that is itself profiled.
+ */
+class AppExport RecomputeProfiler
+{
+public:
+    enum class Category : unsigned char
+    {
+        /// Document level operations, e.g. the whole recompute
+        Document,
+        /// The recomputation of a single object
+        Feature,
+        /// Python code, e.g. the execute() of a Python feature
+        Python,
+        /// Geometry kernel (OCC) algorithms
+        Kernel,
+        /// Other C++ sub-operations, e.g. building the element map
+        Other,
+    };
+    static constexpr std::size_t CategoryCount = 5;
+
+    /// Output format of the recorded profile
+    enum class Format
+    {
+        /// Nested calls with a per-object summary
+        Json,
+        /// Chrome trace event format, for chrome://tracing or Perfetto
+        ChromeTrace,
+    };
+
+    static RecomputeProfiler& instance();
+
+    /// Check whether scopes are being recorded
+    bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Start or stop recording. Already recorded calls are kept.
+    void setEnabled(bool enable);
+
+    /// Discard all recorded calls
+    void clear();
+
+    /// Return the recorded calls in the given format
+    std::string dump(Format format = Format::Json) const;
+
+    /// A recorded call
+    struct Node
+    {
+        std::string name;
+        /// Full name of the object, if any
+        std::string object;
+        Category category = Category::Other;
+        int thread = 0;
+        /// Start time in microseconds since the profiler was cleared
+        double start = 0.0;
+        /// Wall time in microseconds
+        double duration = 0.0;
+        /// Wall time in microseconds split by category
+        std::array<double, CategoryCount> times {};
+        std::vector<Node> children;
+    };
+
+    /// Return the recorded top level calls of all threads
+    std::vector<Node> getNodes() const;
+
+    /// Records the lifetime of the scope as a call if the profiler is enabled
+    class AppExport Scope
+    {
+    public:
+        /**
+         * @param name: name of the call. The string is copied only when the
+         * profiler is enabled.
+         * @param category: category of the time not covered by child scopes
+         * @param object: optional object the call works on
+         */
+        Scope(const char* name, Category category, const DocumentObject* object = nullptr);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        bool active;
+    };
+
+private:
+    RecomputeProfiler();
+
+    void push(const char* name, Category category, const DocumentObject* object);
+    void pop();
+
+    std::atomic<bool> enabled {false};
+    /// Time of the last clear() as a steady clock count
+    std::atomic<std::chrono::steady_clock::rep> epoch;
+    mutable std::mutex mutex;
+    std::vector<Node> nodes;
+};
+
+}  // namespace App
+
+#endif  // APP_RECOMPUTEPROFILER_H
@@ -25,15 +25,27 @@
 
 #include <cassert>
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "Transactions.h"
+#include "ComplexGeoData.h"
 #include "Document.h"
 #include "DocumentObject.h"
 #include "Property.h"
+#include "PropertyGeo.h"
+
+#ifdef _MSC_VER
+#include <zipios++/zipios-config.h>
+#endif
+#include <zipios++/zipinputstream.h>
 
 
 FC_LOG_LEVEL_INIT("App", true, true)
@@ -43,6 +55,17 @@ using namespace std;
 
 TYPESYSTEM_SOURCE(App::Transaction, Base::Persistence)
 
+namespace
+{
+// Persistence::getMemSize() returns unsigned int, so saturate instead of wrapping around
+unsigned int clampMemSize(std::size_t size)
+{
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max())
+    );
+}
+}  // namespace
+
 //**************************************************************************
 // Construction/Destruction
 
@@ -88,6 +111,9 @@ Transaction::~Transaction()
         }
         delete It.second;
     }
+    if (!_SpillFile.empty()) {
+        Base::FileInfo(_SpillFile).deleteFile();
+    }
 }
 
 static std::atomic<int> _TransactionID;
@@ -109,17 +135,133 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    return clampMemSize(getCopySize());
 }
 
-void Transaction::Save(Base::Writer& /*writer*/) const
+std::size_t Transaction::getCopySize() const
 {
-    assert(0);
+    // Summing up the size of shapes is not cheap, so cache it
+    if (!_MemSizeValid) {
+        _MemSize = 0;
+        for (const auto& info : _Objects.get<0>()) {
+            _MemSize += info.second->getCopySize();
+        }
+        _MemSizeValid = true;
+    }
+    return _MemSize;
 }
 
-void Transaction::Restore(Base::XMLReader& /*reader*/)
+void Transaction::Save(Base::Writer& writer) const
 {
-    assert(0);
+    // Only used to write the spill file, see spill()
+    writer.Stream() << writer.ind() << "<Transaction id=\"" << transID << "\" count=\""
+                    << _Objects.size() << "\">\n";
+    writer.incInd();
+    for (const auto& info : _Objects.get<0>()) {
+        info.second->Save(writer);
+    }
+    writer.decInd();
+    writer.Stream() << writer.ind() << "</Transaction>\n";
+}
+
+void Transaction::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("Transaction");
+    if (reader.getAttribute<unsigned long>("count") != _Objects.size()) {
+        throw Base::RuntimeError("Transaction mismatch in spill file");
+    }
+    for (const auto& info : _Objects.get<0>()) {
+        info.second->Restore(reader);
+    }
+    reader.readEndElement("Transaction");
+}
+
+bool Transaction::spill(const std::string& fileName)
+{
+    if (!_SpillFile.empty()) {
+        return true;
+    }
+    bool any = false;
+    for (const auto& info : _Objects.get<0>()) {
+        any = info.second->prepareSpill() || any;
+    }
+    if (!any) {
+        return false;
+    }
+
+    std::string errMsg;
+    Base::FileInfo fi(fileName);
+    try {
+        Base::ofstream file(fi, std::ios::out | std::ios::binary);
+        Base::ZipWriter writer(file);
+        if (!file.is_open()) {
+            throw Base::FileException("Failed to open file", fi);
+        }
+        writer.putNextEntry("Transaction.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>\n";
+        Save(writer);
+        writer.writeFiles();
+        if (writer.hasErrors()) {
+            throw Base::FileException("Failed to write all data to file", fi);
+        }
+    }
+    catch (Base::Exception& e) {
+        errMsg = e.what();
+    }
+    catch (std::exception& e) {
+        errMsg = e.what();
+    }
+
+    bool written = errMsg.empty();
+    for (const auto& info : _Objects.get<0>()) {
+        info.second->finishSpill(written);
+    }
+    if (!written) {
+        FC_ERR("Failed to spill transaction '" << Name << "': " << errMsg);
+        fi.deleteFile();
+        return false;
+    }
+    FC_LOG("Spilled transaction '" << Name << "' to " << fileName);
+    _SpillFile = fileName;
+    _MemSizeValid = false;
+    return true;
+}
+
+bool Transaction::isSpilled() const
+{
+    return !_SpillFile.empty();
+}
+
+void Transaction::unspill()
+{
+    Base::FileInfo fi(_SpillFile);
+    _MemSizeValid = false;
+
+    std::string errMsg;
+    try {
+        Base::ifstream file(fi, std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(file);
+        Base::XMLReader reader(fi.filePath().c_str(), zipstream);
+        if (!reader.isValid()) {
+            throw Base::FileException("Error reading compression file", fi);
+        }
+        Restore(reader);
+        reader.readFiles(zipstream);
+    }
+    catch (Base::Exception& e) {
+        errMsg = e.what();
+    }
+    catch (std::exception& e) {
+        errMsg = e.what();
+    }
+    if (!errMsg.empty()) {
+        // Keep the spill file, applying the transaction without the spilled
+        // property copies would only partially undo or redo it
+        std::string msg = "Failed to read spilled transaction '" + Name + "': " + errMsg;
+        throw Base::FileException(msg, fi);
+    }
+    _SpillFile.clear();
+    fi.deleteFile();
 }
 
 int Transaction::getID() const
@@ -144,6 +286,7 @@ bool Transaction::hasObject(const TransactionalObject* Obj) const
 void Transaction::changeProperty(TransactionalObject* Obj,
                                  std::function<void(TransactionObject* to)> changeFunc)
 {
+    _MemSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -181,6 +324,11 @@ void Transaction::addOrRemoveProperty(TransactionalObject* Obj, const Property*
 
 void Transaction::apply(Document& Doc, bool forward)
 {
+    // Throws before touching the document if the spill file cannot be read
+    if (!_SpillFile.empty()) {
+        unspill();
+    }
+
     std::string errMsg;
     try {
         auto& index = _Objects.get<0>();
@@ -211,6 +359,7 @@ void Transaction::apply(Document& Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject* Obj)
 {
+    _MemSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -240,6 +389,7 @@ void Transaction::addObjectNew(TransactionalObject* Obj)
 
 void Transaction::addObjectDel(const TransactionalObject* Obj)
 {
+    _MemSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -261,6 +411,7 @@ void Transaction::addObjectDel(const TransactionalObject* Obj)
 
 void Transaction::addObjectChange(const TransactionalObject* Obj, const Property* Prop)
 {
+    _MemSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -458,17 +609,119 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    return clampMemSize(getCopySize());
 }
 
-void TransactionObject::Save(Base::Writer& /*writer*/) const
+std::size_t TransactionObject::getCopySize() const
 {
-    assert(0);
+    std::size_t size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.property && v.second.nameOrig.empty()) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
-void TransactionObject::Restore(Base::XMLReader& /*reader*/)
+bool TransactionObject::canSpill(const PropData& data)
 {
-    assert(0);
+    // Property copies below this size are not worth the file round trip
+    constexpr std::size_t minSize = 1024 * 1024;
+
+    if (!data.property || !data.nameOrig.empty()) {
+        return false;
+    }
+    // Only spill geometry without element map. An element map refers to
+    // strings of the document hasher that are only kept alive by the copy.
+    // A copy sharing its geometry, e.g. a shape, would not free memory, and
+    // would not share it any more once read back.
+    auto prop = freecad_cast<const PropertyComplexGeoData*>(data.property);
+    if (!prop || !prop->isCopyOwningData() || prop->getMemSize() < minSize) {
+        return false;
+    }
+    auto geo = prop->getComplexData();
+    return geo && geo->getElementMapSize() == 0;
+}
+
+bool TransactionObject::prepareSpill()
+{
+    bool any = false;
+    for (auto& v : _PropChangeMap) {
+        v.second.spilled = canSpill(v.second);
+        any = any || v.second.spilled;
+    }
+    return any;
+}
+
+void TransactionObject::finishSpill(bool written)
+{
+    for (auto& v : _PropChangeMap) {
+        auto& data = v.second;
+        if (!data.spilled) {
+            continue;
+        }
+        if (written) {
+            delete data.property;
+            data.property = nullptr;
+        }
+        else {
+            data.spilled = false;
+        }
+    }
+}
+
+void TransactionObject::Save(Base::Writer& writer) const
+{
+    // Only the property copies marked by prepareSpill() are saved
+    std::size_t count = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.spilled) {
+            ++count;
+        }
+    }
+    writer.Stream() << writer.ind() << "<TransactionObject count=\"" << count << "\">\n";
+    writer.incInd();
+    for (const auto& [id, data] : _PropChangeMap) {
+        if (!data.spilled) {
+            continue;
+        }
+        writer.Stream() << writer.ind() << "<Property id=\"" << id << "\" type=\""
+                        << data.property->getTypeId().getName() << "\" status=\""
+                        << data.property->getStatus() << "\">\n";
+        writer.incInd();
+        data.property->Save(writer);
+        writer.decInd();
+        writer.Stream() << writer.ind() << "</Property>\n";
+    }
+    writer.decInd();
+    writer.Stream() << writer.ind() << "</TransactionObject>\n";
+}
+
+void TransactionObject::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("TransactionObject");
+    auto count = reader.getAttribute<unsigned long>("count");
+    for (unsigned long i = 0; i < count; ++i) {
+        reader.readElement("Property");
+        auto it = _PropChangeMap.find(std::stoll(reader.getAttribute<const char*>("id")));
+        if (it == _PropChangeMap.end() || (!it->second.spilled && !it->second.property)) {
+            throw Base::RuntimeError("Unknown property in spill file");
+        }
+        const char* type = reader.getAttribute<const char*>("type");
+        auto prop = static_cast<Property*>(Base::Type::createInstanceByName(type, true));
+        if (!prop) {
+            throw Base::TypeError(std::string("Cannot create property of type ") + type);
+        }
+        prop->setStatusValue(reader.getAttribute<unsigned long>("status"));
+        prop->Restore(reader);
+        // The copy may be read already by an earlier failed attempt, see
+        // Transaction::unspill()
+        delete it->second.property;
+        it->second.property = prop;
+        it->second.spilled = false;
+        reader.readEndElement("Property");
+    }
+    reader.readEndElement("TransactionObject");
 }
 
 //**************************************************************************
@@ -27,6 +27,7 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <cstddef>
 #include <unordered_map>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
@@ -73,6 +74,9 @@ public:
      *
      * @param[in] Doc The document to apply the transaction to.
      * @param[in] forward If true, apply the transaction; otherwise, undo it.
+     *
+     * @throw Base::FileException if the spilled property copies cannot be
+     * read back. The document is left unchanged in this case.
      */
     void apply(Document& Doc, bool forward);
 
@@ -80,6 +84,8 @@ public:
     std::string Name;
 
     unsigned int getMemSize() const override;
+    /// Same as getMemSize() but without limiting the size to unsigned int
+    std::size_t getCopySize() const;
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
@@ -143,12 +149,30 @@ public:
      */
     void addObjectChange(const TransactionalObject* Obj, const Property* Prop);
 
+    /**
+     * @brief Write the large property copies of this transaction to a file.
+     *
+     * The copies are released from memory and read back from the file right
+     * before the transaction is applied.
+     *
+     * @param[in] fileName The file to write to.
+     * @return true if any property copy is written to the file.
+     */
+    bool spill(const std::string& fileName);
+
+    /// Check if the property copies of this transaction are written to a file.
+    bool isSpilled() const;
+
 private:
     void changeProperty(TransactionalObject* Obj,
                         std::function<void(TransactionObject* to)> changeFunc);
+    void unspill();
 
 private:
     int transID;
+    std::string _SpillFile;
+    mutable std::size_t _MemSize {0};
+    mutable bool _MemSizeValid {false};
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -223,7 +247,10 @@ public:
      */
     void addOrRemoveProperty(const Property* prop, bool add);
 
+    /// The memory used by the property copies kept for undo/redo.
     unsigned int getMemSize() const override;
+    /// Same as getMemSize() but without limiting the size to unsigned int
+    std::size_t getCopySize() const;
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
@@ -245,8 +272,17 @@ protected:
         const Property* propertyOrig = nullptr;
         // for property renaming
         std::string nameOrig;
+        // the property copy is written to the spill file of the transaction
+        bool spilled = false;
     };
 
+    /// Check if a property copy is large enough to be written to a spill file.
+    static bool canSpill(const PropData& data);
+    /// Mark the property copies to spill, return true if there is any.
+    bool prepareSpill();
+    /// Release the spilled property copies if @p written, else unmark them.
+    void finishSpill(bool written);
+
     /// A map to maintain the properties of the object.
     std::unordered_map<int64_t, PropData> _PropChangeMap;
 
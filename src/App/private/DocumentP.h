@@ -29,9 +29,13 @@
 #pragma warning(disable : 4834)
 #endif
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -45,6 +49,7 @@
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
 #include <App/ExportInfo.h>
+#include <Base/Matrix.h>
 #include <Base/UniqueNameManager.h>
 
 // using VertexProperty = boost::property<boost::vertex_root_t, DocumentObject* >;
@@ -80,6 +85,11 @@ struct DocumentP
     std::unordered_map<long, DocumentObject*> objectIdMap;
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
+    // Objects in dependency order, maintained incrementally on link changes.
+    // Removed objects leave a nullptr hole until the array is compacted.
+    std::vector<DocumentObject*> topoOrder;
+    std::size_t topoOrderHoles {0};
+    bool topoOrderDirty {false};
     long lastObjectId {};
     DocumentObject* activeObject {nullptr};
     Transaction* activeUndoTransaction {nullptr};
@@ -104,6 +114,41 @@ struct DocumentP
 
     Document::PreRecomputeHook _preRecomputeHook;
 
+    // Guards the document state shared with objects being recomputed on
+    // worker threads, i.e. the recompute log and the undo transaction.
+    std::recursive_mutex recomputeMutex;
+
+    // Results of DocumentObject::getSubObject() for objects of this document,
+    // see DocumentObject::getCachedSubObject(). The matrix is relative to the
+    // parent object. The cache is dropped on any property change, and on
+    // adding or removing an object in any document, because sub-objects may
+    // be linked from other documents.
+    struct SubObjectCacheEntry
+    {
+        DocumentObject* object;
+        Base::Matrix4D matrix;
+    };
+    std::map<std::tuple<const DocumentObject*, bool, std::string>, SubObjectCacheEntry>
+        subObjectCache;
+    int64_t subObjectCacheRevision {-1};
+    int64_t subObjectCacheGeneration {-1};
+    std::mutex subObjectCacheMutex;
+    // Incremented on adding or removing an object in any document
+    static std::atomic<int64_t> objectGeneration;
+
+    // Objects created in the current batch, with the transaction they were
+    // added to, see Document::beginBatch()
+    int batchDepth {0};
+    std::vector<std::pair<DocumentObject*, Transaction*>> batchObjects;
+
+    // Object property changes recorded while coalescing, see
+    // Document::beginCoalesceChanges(). Recorded by object ID and property
+    // name, so that objects and properties removed in the meantime are
+    // skipped on delivery.
+    int coalesceDepth {0};
+    std::vector<std::pair<long, std::string>> coalescedChanges;
+    std::set<std::pair<long, std::string>> coalescedChangeSet;
+
     DocumentP();
 
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
@@ -122,6 +167,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -137,10 +183,20 @@ struct DocumentP
         }
     }
 
+    void clearTopoOrder()
+    {
+        topoOrder.clear();
+        topoOrderHoles = 0;
+        topoOrderDirty = false;
+    }
+
     void clearDocument()
     {
+        ++objectGeneration;
+        batchObjects.clear();
         objectLabelManager.clear();
         objectArray.clear();
+        clearTopoOrder();
         for (auto& v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
             delete (v.second);
@@ -30,8 +30,13 @@
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 # include <unistd.h>
 #endif
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 #include "Console.h"
 #include "PyObjectBase.h"
@@ -71,9 +76,110 @@ public:
     {}
 };
 
+/** A bounded lock-free queue of console messages
+ *
+ * Any number of threads may push, see D. Vyukov's bounded MPMC queue. Each
+ * slot carries a sequence number telling whether it is free for the producer
+ * of a given position or filled for the consumer.
+ */
+class ConsoleQueue
+{
+public:
+    struct Message
+    {
+        LogStyle category {LogStyle::Log};
+        IntendedRecipient recipient {IntendedRecipient::All};
+        ContentType content {ContentType::Untranslated};
+        std::string notifier;
+        std::string msg;
+    };
+
+    static constexpr std::size_t Capacity = 4096;
+
+    ConsoleQueue()
+        : slots(std::make_unique<Slot[]>(Capacity))  // NOLINT
+    {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// Moves the message into the queue, returns false if the queue is full
+    bool push(Message& message)
+    {
+        std::size_t pos = tail.load(std::memory_order_relaxed);
+        Slot* slot {};
+        for (;;) {
+            slot = &slots[pos & (Capacity - 1)];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        slot->message = std::move(message);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Takes the oldest message, returns false if the queue is empty
+    bool pop(Message& message)
+    {
+        std::size_t pos = head.load(std::memory_order_relaxed);
+        Slot* slot {};
+        for (;;) {
+            slot = &slots[pos & (Capacity - 1)];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+        message = std::move(slot->message);
+        slot->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence {0};
+        Message message;
+    };
+
+    std::unique_ptr<Slot[]> slots;  // NOLINT
+    alignas(64) std::atomic<std::size_t> head {0};
+    alignas(64) std::atomic<std::size_t> tail {0};
+};
+
 class ConsoleOutput: public QObject  // clazy:exclude=missing-qobject-macro
 {
 public:
+    static constexpr auto DrainEvent = static_cast<QEvent::Type>(QEvent::User + 1);
+
+    ConsoleQueue queue;
+    /// Set while a DrainEvent is posted but not yet handled
+    std::atomic<bool> drainPosted {false};
+    /// Serializes the notification of queued messages. Recursive because an
+    /// observer may log while being notified.
+    std::recursive_mutex drainMutex;
+
     static ConsoleOutput* getInstance()
     {
         if (!instance) {
@@ -81,15 +187,38 @@ public:
         }
         return instance;
     }
+    static ConsoleOutput* getExistingInstance()
+    {
+        return instance;
+    }
     static void destruct()
     {
         delete instance;
         instance = nullptr;
     }
 
+    /// Notifies the observers of the queued messages, drainMutex must be locked
+    void drain()
+    {
+        ConsoleQueue::Message message;
+        while (queue.pop(message)) {
+            Console().notifyPrivate(
+                message.category,
+                message.recipient,
+                message.content,
+                message.notifier,
+                message.msg
+            );
+        }
+    }
+
     void customEvent(QEvent* ev) override
     {
-        if (ev->type() == QEvent::User) {
+        if (ev->type() == DrainEvent) {
+            drainPosted = false;
+            Console().flush();
+        }
+        else if (ev->type() == QEvent::User) {
             switch (const auto ce = static_cast<ConsoleEvent*>(ev); ce->msgtype) {
                 case ConsoleSingleton::MsgType_Txt:
                     Console().notifyPrivate(
@@ -171,6 +300,7 @@ ConsoleSingleton::ConsoleSingleton()
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    flush();
     ConsoleOutput::destruct();
     for (ILogger* Iter : _aclObservers) {  // NOLINT
         delete Iter;
@@ -280,9 +410,52 @@ void ConsoleSingleton::setConnectionMode(const ConnectionMode mode)
     connectionMode = mode;
 
     // make sure this method gets called from the main thread
-    if (connectionMode == Queued) {
+    if (connectionMode != Direct) {
         ConsoleOutput::getInstance();
     }
+    else {
+        flush();
+    }
+}
+
+void ConsoleSingleton::flush()
+{
+    ConsoleOutput* output = ConsoleOutput::getExistingInstance();
+    if (!output) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(output->drainMutex);
+    output->drain();
+}
+
+void ConsoleSingleton::pushAsync(
+    const LogStyle category,
+    const IntendedRecipient recipient,
+    const ContentType content,
+    const std::string& notifiername,
+    std::string&& msg
+)
+{
+    ConsoleOutput* output = ConsoleOutput::getInstance();
+    ConsoleQueue::Message message {category, recipient, content, notifiername, std::move(msg)};
+    if (!output->queue.push(message)) {
+        // The buffer is full. Rather than dropping or reordering messages,
+        // deliver the backlog and this message on the calling thread.
+        std::lock_guard<std::recursive_mutex> lock(output->drainMutex);
+        output->drain();
+        notifyPrivate(category, recipient, content, notifiername, message.msg);
+        return;
+    }
+    if (!output->drainPosted.exchange(true)) {
+        QCoreApplication::postEvent(output, new QEvent(ConsoleOutput::DrainEvent));
+    }
+}
+
+bool ConsoleSingleton::hasActiveObserver(const LogStyle category) const
+{
+    return std::any_of(_aclObservers.begin(), _aclObservers.end(), [category](ILogger* obs) {
+        return obs->isActive(category);
+    });
 }
 
 //**************************************************************************
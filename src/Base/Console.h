@@ -795,8 +795,15 @@ public:
     };
     enum ConnectionMode
     {
+        /// Observers are notified on the calling thread
         Direct = 0,
-        Queued = 1
+        /// Each message is posted as an event to the main thread
+        Queued = 1,
+        /** Messages are pushed into a lock-free ring buffer, which is drained
+         *  in the main thread's event loop or by flush(). When the buffer is
+         *  full, the sender drains it and notifies directly.
+         */
+        Async = 2
     };
 
     enum FreeCAD_ConsoleMsgType
@@ -814,6 +821,8 @@ public:
     /// Checks if message types of a certain console observer are enabled
     bool isMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType type) const;
     void setConnectionMode(ConnectionMode mode);
+    /// Notifies the observers of all messages queued in Async mode
+    void flush();
 
     int* getLogLevel(const char* tag, bool create = true);
 
@@ -888,6 +897,15 @@ private:
         const std::string& notifiername,
         const std::string& msg
     ) const;
+    void pushAsync(
+        LogStyle category,
+        IntendedRecipient recipient,
+        ContentType content,
+        const std::string& notifiername,
+        std::string&& msg
+    );
+    /// Checks if any observer takes messages of the given category
+    bool hasActiveObserver(LogStyle category) const;
 
     // singleton
     static void Destruct();
@@ -1196,6 +1214,11 @@ template<
     typename... Args>
 void Base::ConsoleSingleton::send(const std::string& notifiername, const char* pMsg, Args&&... args)
 {
+    // Do not format a message nobody is going to see
+    if (!hasActiveObserver(category)) {
+        return;
+    }
+
     std::string format;
     try {
         format = fmt::sprintf(pMsg, args...);
@@ -1211,6 +1234,9 @@ void Base::ConsoleSingleton::send(const std::string& notifiername, const char* p
     if (connectionMode == Direct) {
         notify<category, recipient, contenttype>(notifiername, format);
     }
+    else if (connectionMode == Async) {
+        pushAsync(category, recipient, contenttype, notifiername, std::move(format));
+    }
     else {
 
         const auto type = getConsoleMsg(category);
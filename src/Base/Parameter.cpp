@@ -38,6 +38,8 @@
 #include <xercesc/sax/SAXParseException.hpp>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 #include <QFileInfo>
@@ -158,6 +160,121 @@ inline bool DOMTreeErrorReporter::getSawErrors() const
     return fSawErrors;
 }
 
+struct ParameterGrp::ValueCache
+{
+    struct NameHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view> {}(name);
+        }
+    };
+    // Transparent lookup, so that reading a value does not allocate
+    template<typename T>
+    using Map = std::unordered_map<std::string, T, NameHash, std::equal_to<>>;
+
+    Map<bool> bools;
+    Map<long> ints;
+    Map<unsigned long> uints;
+    Map<double> floats;
+    Map<std::string> texts;
+
+    template<typename T>
+    static const T* find(const Map<T>& map, const char* name)
+    {
+        if (!name) {
+            return nullptr;
+        }
+        auto it = map.find(std::string_view(name));
+        return it == map.end() ? nullptr : &it->second;
+    }
+
+    template<typename T>
+    static void set(Map<T>& map, const char* name, T value, bool replace)
+    {
+        if (replace) {
+            map.insert_or_assign(name, std::move(value));
+        }
+        else {
+            // keep the first element like FindElement() does
+            map.try_emplace(name, std::move(value));
+        }
+    }
+
+    /// Store the value as parsed by the getters from its persistent form
+    void set(ParamType type, const char* name, const char* value, bool replace = true)
+    {
+        if (!name || !value) {
+            return;
+        }
+        const int base = 10;
+        switch (type) {
+            case ParamType::FCBool:
+                set(bools, name, strcmp(value, "1") == 0, replace);
+                break;
+            case ParamType::FCInt:
+                set(ints, name, atol(value), replace);
+                break;
+            case ParamType::FCUInt:
+                set(uints, name, strtoul(value, nullptr, base), replace);
+                break;
+            case ParamType::FCFloat:
+                set(floats, name, atof(value), replace);
+                break;
+            case ParamType::FCText:
+                set(texts, name, std::string(value), replace);
+                break;
+            default:
+                break;
+        }
+    }
+
+    template<typename T>
+    static void remove(Map<T>& map, const char* name)
+    {
+        auto it = map.find(std::string_view(name));
+        if (it != map.end()) {
+            map.erase(it);
+        }
+    }
+
+    void remove(ParamType type, const char* name)
+    {
+        if (!name) {
+            return;
+        }
+        switch (type) {
+            case ParamType::FCBool:
+                remove(bools, name);
+                break;
+            case ParamType::FCInt:
+                remove(ints, name);
+                break;
+            case ParamType::FCUInt:
+                remove(uints, name);
+                break;
+            case ParamType::FCFloat:
+                remove(floats, name);
+                break;
+            case ParamType::FCText:
+                remove(texts, name);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void clear()
+    {
+        bools.clear();
+        ints.clear();
+        uints.clear();
+        floats.clear();
+        texts.clear();
+    }
+};
+
 
 //**************************************************************************
 //**************************************************************************
@@ -173,6 +290,7 @@ inline bool DOMTreeErrorReporter::getSawErrors() const
  */
 ParameterGrp::ParameterGrp(DOMElement* GroupNode, const char* sName, ParameterGrp* Parent)
     : _pGroupNode(GroupNode)
+    , _Cache(std::make_unique<ValueCache>())
     , _Parent(Parent)
 {
     if (sName) {
@@ -181,6 +299,7 @@ ParameterGrp::ParameterGrp(DOMElement* GroupNode, const char* sName, ParameterGr
     if (_Parent) {
         _Manager = _Parent->_Manager;
     }
+    _BuildCache();
 }
 
 
@@ -682,6 +801,41 @@ void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
     }
 }
 
+void ParameterGrp::_BuildCache()
+{
+    _Cache->clear();
+    if (!_pGroupNode) {
+        return;
+    }
+
+    for (DOMNode* child = _pGroupNode->getFirstChild(); child != nullptr;
+         child = child->getNextSibling()) {
+        if (child->getNodeType() != DOMNode::ELEMENT_NODE) {
+            continue;
+        }
+        ParamType type = TypeValue(StrX(child->getNodeName()).c_str());
+        if (type == ParamType::FCInvalid || type == ParamType::FCGroup) {
+            continue;
+        }
+        auto pcElem = static_cast<DOMElement*>(child);
+        DOMNode* attr = pcElem->getAttributes()->getNamedItem(XStrLiteral("Name").unicodeForm());
+        if (!attr) {
+            continue;
+        }
+        std::string Name = StrX(attr->getNodeValue()).c_str();
+        if (type == ParamType::FCText) {
+            DOMNode* pcElem2 = pcElem->getFirstChild();
+            std::string Value = pcElem2 ? StrXUTF8(pcElem2->getNodeValue()).c_str() : "";
+            _Cache->set(type, Name.c_str(), Value.c_str(), false);
+        }
+        else {
+            std::string Value =
+                StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str();
+            _Cache->set(type, Name.c_str(), Value.c_str(), false);
+        }
+    }
+}
+
 void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Value)
 {
     const char* Type = TypeName(T);
@@ -704,6 +858,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
     // find or create the Element
     DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
     if (pcElem) {
+        _Cache->set(T, Name, Value);
         XStr attr("Value");
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
@@ -723,15 +878,8 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
-        return bPreset;
-    }
-
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1") == 0);
+    auto value = ValueCache::find(_Cache->bools, Name);
+    return value ? *value : bPreset;
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -801,14 +949,8 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    auto value = ValueCache::find(_Cache->ints, Name);
+    return value ? *value : lPreset;
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -872,16 +1014,8 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), nullptr, base);
+    auto value = ValueCache::find(_Cache->uints, Name);
+    return value ? *value : lPreset;
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -953,14 +1087,8 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
-    }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    auto value = ValueCache::find(_Cache->floats, Name);
+    return value ? *value : dPreset;
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1042,6 +1170,7 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
         isNew = true;
     }
     if (pcElem) {
+        _Cache->set(ParamType::FCText, Name, sValue);
         // and set the value
         DOMNode* pcElem2 = pcElem->getFirstChild();
         if (!pcElem2) {
@@ -1067,21 +1196,14 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
         return pPreset ? pPreset : "";
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
+    auto value = ValueCache::find(_Cache->texts, Name);
+    if (!value) {
         if (!pPreset) {
             return {};
         }
         return {pPreset};
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    return *value;
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1163,6 +1285,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _Cache->remove(ParamType::FCText, Name);
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1184,6 +1307,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _Cache->remove(ParamType::FCBool, Name);
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1206,6 +1330,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _Cache->remove(ParamType::FCFloat, Name);
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1227,6 +1352,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _Cache->remove(ParamType::FCInt, Name);
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1248,6 +1374,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _Cache->remove(ParamType::FCUInt, Name);
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1414,6 +1541,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _Cache->clear();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1585,6 +1713,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _Cache->clear();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1926,6 +2055,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE::InputSource& inpu
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
     }
+    _BuildCache();
 
     return 1;
 }
@@ -2049,6 +2179,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _BuildCache();
 }
 
 void ParameterManager::CheckDocument() const
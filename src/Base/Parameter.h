@@ -50,6 +50,7 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <fastsignals/signal.h>
 #include <xercesc/util/XercesDefs.hpp>
@@ -442,6 +443,9 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /// Rebuild the value cache from the DOM node of this group
+    void _BuildCache();
+
     XERCES_CPP_NAMESPACE::DOMElement* FindNextElement(
         XERCES_CPP_NAMESPACE::DOMNode* Prev,
         const char* Type
@@ -485,6 +489,14 @@ protected:
 
     /// DOM Node of the Base node of this group
     XERCES_CPP_NAMESPACE::DOMElement* _pGroupNode;
+    /** Typed copy of the values of this group
+     *
+     * The getters read the values from here instead of searching and
+     * transcoding the DOM, which is only kept up to date for persistence.
+     * Every modification of the values updates both.
+     */
+    struct ValueCache;
+    std::unique_ptr<ValueCache> _Cache;
     /// the own name
     std::string _cName;
     /// map of already exported groups
@@ -79,6 +79,16 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::canRestoreDocFileAsync() const
+{
+    return false;
+}
+
+std::function<void()> Persistence::restoreDocFileAsync(Reader& /*reader*/)
+{
+    throw Base::NotImplementedError("Persistence::restoreDocFileAsync");
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
@@ -26,6 +26,8 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <functional>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -147,6 +149,20 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** This method tells whether the file of this object can be parsed on a worker thread
+     * It is called on the main thread before the file is read. If it returns true
+     * XMLReader::readFiles() may call restoreDocFileAsync() instead of RestoreDocFile().
+     * The default implementation returns false.
+     */
+    virtual bool canRestoreDocFileAsync() const;
+    /** This method is used to parse a file on a worker thread
+     * The implementation reads the data from the given reader without changing
+     * this object or any other shared state, and returns a function that applies
+     * the parsed data. The returned function is called on the main thread in the
+     * order the files were registered with XMLReader::addFile().
+     * @see canRestoreDocFileAsync()
+     */
+    virtual std::function<void()> restoreDocFileAsync(Reader& reader);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
     /// Replaces all characters with '_' that are not allowed in XML
@@ -22,9 +22,12 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <deque>
+#include <future>
 #include <map>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -452,6 +455,33 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+
+    // The zip stream can only be decompressed sequentially. But the data of objects
+    // supporting restoreDocFileAsync() is parsed on worker threads while the next
+    // entries are decompressed. The parsed data is applied in the order of the files.
+    struct PendingFile
+    {
+        std::string FileName;
+        std::future<std::function<void()>> Result;
+    };
+    std::deque<PendingFile> pending;
+    const std::size_t maxPending = FileThreads > 1 ? static_cast<std::size_t>(FileThreads) : 0;
+    auto applyPending = [&](std::size_t keep) {
+        while (pending.size() > keep) {
+            PendingFile file = std::move(pending.front());
+            pending.pop_front();
+            try {
+                if (auto apply = file.Result.get()) {
+                    apply();
+                }
+            }
+            catch (...) {
+                Base::Console().error("Reading failed from embedded file: %s\n", file.FileName.c_str());
+                FailedFiles.push_back(file.FileName);
+            }
+        }
+    };
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -463,7 +493,29 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         }
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (jt != FileList.end() && maxPending > 0 && jt->Object->canRestoreDocFileAsync()) {
+            std::ostringstream data;
+            data << zipstream.rdbuf();
+            pending.push_back(PendingFile {
+                jt->FileName,
+                std::async(
+                    std::launch::async,
+                    [object = jt->Object,
+                     name = jt->FileName,
+                     version = FileVersion,
+                     buffer = std::move(data).str()]() mutable {
+                        std::istringstream str(std::move(buffer));
+                        Base::Reader reader(str, name, version);
+                        return object->restoreDocFileAsync(reader);
+                    }
+                )
+            });
+            applyPending(maxPending);
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
+            // keep the order of the files
+            applyPending(0);
             try {
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
@@ -498,6 +550,8 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    applyPending(0);
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
@@ -147,6 +147,11 @@ public:
     {
         return _valid;
     }
+    /// Return the path of the file being read
+    std::string getFileName() const
+    {
+        return _File.filePath();
+    }
     bool isVerbose() const
     {
         return _verbose;
@@ -296,6 +301,8 @@ public:
     std::string ProgramVersion;
     /// Version of the file format
     int FileVersion {0};
+    /// Number of files that readFiles() parses in parallel, 0 or 1 reads them one by one
+    int FileThreads {0};
 
     /// sets simultaneously the global and local PartialRestore bits
     void setPartialRestore(bool on);
@@ -57,6 +57,13 @@ struct Base::TypeData
     const Type parent;
     const Type type;
     const Type::instantiationMethod instMethod;
+    /** The chain of types from the root of the class tree down to this type
+     *
+     * A type is derived from another one if the other type is found in this
+     * chain at the other type's depth, which makes isDerivedFrom() a constant
+     * time check.
+     */
+    std::vector<Type> ancestors;
 };
 
 namespace
@@ -64,7 +71,7 @@ namespace
 constexpr const char* BadTypeName = "BadType";
 }
 
-std::map<std::string, unsigned int> Type::typemap;
+std::unordered_map<std::string, Type::TypeId, Type::NameHash, std::equal_to<>> Type::typemap;
 std::vector<TypeData*> Type::typedata;
 std::set<std::string> Type::loadModuleSet;
 
@@ -143,7 +150,12 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
-    Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
+    auto data = new TypeData(name, newType, parent, method);
+    if (!parent.isBad()) {
+        data->ancestors = typedata[parent.index]->ancestors;
+    }
+    data->ancestors.push_back(newType);
+    Type::typedata.emplace_back(data);
 
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
@@ -156,6 +168,7 @@ void Type::init()
 {
     assert(Type::typedata.size() == 0 && "Type::init() should only be called once");
     typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
+    typedata.back()->ancestors.push_back(BadType);
     typemap[BadTypeName] = 0;
 }
 
@@ -171,7 +184,10 @@ void Type::destruct()
 
 const Type Type::fromName(const char* name)
 {
-    const auto pos = typemap.find(name);
+    if (!name) {
+        return Type::BadType;
+    }
+    const auto pos = typemap.find(std::string_view(name));
     if (pos == typemap.end()) {
         return Type::BadType;
     }
@@ -206,15 +222,12 @@ const Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
-
-    return false;
+    assert(
+        typedata.size() > index && typedata.size() > type.index && "Type index out of bounds"
+    );
+    const auto& chain = typedata[index]->ancestors;
+    const std::size_t depth = typedata[type.index]->ancestors.size() - 1;
+    return depth < chain.size() && chain[depth] == type;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
@@ -123,6 +123,52 @@ std::string Base::UniqueNameManager::makeUniqueName(
     return namePrefix + digits + nameSuffix;
 }
 
+std::vector<std::string> Base::UniqueNameManager::makeUniqueNames(
+    const std::string& modelName,
+    std::size_t count,
+    std::size_t minDigits
+) const
+{
+    std::vector<std::string> names;
+    if (count == 0) {
+        return names;
+    }
+    names.reserve(count);
+    auto [namePrefix, nameSuffix, digitCount, digitsValue] = decomposeName(modelName);
+    std::string baseName = namePrefix + nameSuffix;
+    auto baseNameEntry = uniqueSeeds.find(baseName);
+    if (baseNameEntry == uniqueSeeds.end()) {
+        // First use of baseName, the first name is the base name with no unique digits.
+        // After that only the base name is taken, so we continue as makeUniqueName would.
+        names.push_back(baseName);
+        digitCount = 0;
+        digitsValue = UnlimitedUnsigned(1);
+    }
+    else {
+        digitCount = baseNameEntry->second.size() - 1;
+        digitsValue = baseNameEntry->second[digitCount].next();
+    }
+    if (digitCount < minDigits) {
+        digitCount = minDigits;
+        digitsValue = UnlimitedUnsigned(1);
+    }
+    // Each name takes the next value above all the values we have for digitCount. If the
+    // value outgrows digitCount it lands in a digit count that has never been used, so the
+    // following values are free as well.
+    while (names.size() < count) {
+        std::string digits = digitsValue.toString();
+        std::string name = namePrefix;
+        if (digitCount > digits.size()) {
+            name.append(digitCount - digits.size(), '0');
+        }
+        name += digits;
+        name += nameSuffix;
+        names.push_back(std::move(name));
+        digitsValue = digitsValue + 1;
+    }
+    return names;
+}
+
 void Base::UniqueNameManager::removeExactName(const std::string& name)
 {
     auto duplicateCountFound = duplicateCounts.find(name);
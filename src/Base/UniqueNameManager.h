@@ -32,6 +32,7 @@
 #include <string>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <utility>  // Forward declares std::tuple
 #include <stdexcept>
 #include <algorithm>
@@ -202,10 +203,12 @@ private:
     // Keyed as uniqueSeeds[baseName][digitCount][digitValue] iff that seed is taken.
     // We need the double-indexing so that Name01 and Name001 can both be indexed, although we only
     // ever allocate off the longest for each name i.e. uniqueSeeds[baseName].size()-1 digits.
-    std::map<std::string, std::vector<PiecewiseSparseIntegerSet<UnlimitedUnsigned>>> uniqueSeeds;
+    // Hashed since every lookup is by exact base name, and there may be many base names.
+    std::unordered_map<std::string, std::vector<PiecewiseSparseIntegerSet<UnlimitedUnsigned>>>
+        uniqueSeeds;
     // Counts of inserted strings that have duplicates, i.e. more than one instance in the
     // collection. This does not contain entries for singleton names.
-    std::map<std::string, unsigned int> duplicateCounts;
+    std::unordered_map<std::string, unsigned int> duplicateCounts;
 
     /// @brief Break a uniquified name into its parts
     /// @param name The name to break up
@@ -231,6 +234,12 @@ public:
     /// in the collection of names. The model name may already contain uniquifying digits
     /// which will be stripped and replaced with other digits as needed.
     std::string makeUniqueName(const std::string& modelName, std::size_t minDigits = 0) const;
+    /// Generate count distinct names that are not in the collection, the same as calling
+    /// makeUniqueName followed by addExactName count times, except that the names are not
+    /// added. This only looks up the base name once, so it is meant for creating many
+    /// names at a time.
+    std::vector<std::string>
+    makeUniqueNames(const std::string& modelName, std::size_t count, std::size_t minDigits = 0) const;
     /// Remove a registered name so it can be generated again. If the name was added
     /// several times this decrements the count, and the name is only fully removed when
     /// the count of removes equals or exceeds the count of adds.
@@ -23,8 +23,11 @@
  ***************************************************************************/
 
 
+#include <deque>
+#include <future>
 #include <memory>
 #include <set>
+#include <thread>
 #include <vector>
 #include <string>
 
@@ -43,6 +46,7 @@
 
 #include <boost/iostreams/filtering_stream.hpp>
 #include <zipios++/zipinputstream.h>
+#include <zlib.h>
 
 using namespace Base;
 
@@ -315,12 +319,65 @@ void Writer::putNextEntry(const char* file, const char* obj)
 
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+struct CompressedEntry
+{
+    std::string data;
+    zipios::StorageMethod method {zipios::STORED};
+    uint32_t size {0};
+    uint32_t crc {0};
+};
+
+CompressedEntry compressEntry(std::string data, int level)
+{
+    CompressedEntry entry;
+    entry.size = static_cast<uint32_t>(data.size());
+    entry.crc = crc32(
+        crc32(0L, Z_NULL, 0),
+        reinterpret_cast<const Bytef*>(data.data()),  // NOLINT
+        static_cast<uInt>(data.size())
+    );
+
+    if (level != 0 && !data.empty()) {
+        z_stream zs {};
+        // negative window bits to write raw deflate data without zlib header
+        if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+            std::string out(deflateBound(&zs, static_cast<uLong>(data.size())), '\0');
+            zs.next_in = reinterpret_cast<Bytef*>(data.data());  // NOLINT
+            zs.avail_in = static_cast<uInt>(data.size());
+            zs.next_out = reinterpret_cast<Bytef*>(out.data());  // NOLINT
+            zs.avail_out = static_cast<uInt>(out.size());
+            int err = deflate(&zs, Z_FINISH);
+            out.resize(zs.total_out);
+            deflateEnd(&zs);
+
+            // Data that barely compresses, e.g. binary payloads, is stored as is
+            if (err == Z_STREAM_END && out.size() < data.size() - data.size() / 16) {
+                entry.data = std::move(out);
+                entry.method = zipios::DEFLATED;
+                return entry;
+            }
+        }
+    }
+
+    entry.data = std::move(data);
+    entry.method = zipios::STORED;
+    return entry;
+}
+
+}  // namespace
+
 ZipWriter::ZipWriter(const char* FileName)
     : ZipStream(FileName)
 {
     ZipStream.imbue(std::locale::classic());
     ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
     ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    EntryStream.imbue(std::locale::classic());
+    EntryStream.precision(std::numeric_limits<double>::digits10 + 1);
+    EntryStream.setf(std::ios::fixed, std::ios::floatfield);
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
@@ -329,6 +386,9 @@ ZipWriter::ZipWriter(std::ostream& os)
     ZipStream.imbue(std::locale::classic());
     ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
     ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    EntryStream.imbue(std::locale::classic());
+    EntryStream.precision(std::numeric_limits<double>::digits10 + 1);
+    EntryStream.setf(std::ios::fixed, std::ios::floatfield);
 }
 
 void ZipWriter::putNextEntry(const char* file, const char* obj)
@@ -341,6 +401,70 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 }
 
 void ZipWriter::writeFiles()
+{
+    std::size_t maxPending = threads > 0 ? static_cast<std::size_t>(threads)
+                                         : std::thread::hardware_concurrency();
+    if (maxPending <= 1) {
+        writeFilesSerial();
+        return;
+    }
+
+    struct PendingEntry
+    {
+        std::string FileName;
+        std::future<CompressedEntry> Result;
+    };
+    std::deque<PendingEntry> pending;
+    auto writePending = [&](std::size_t keep) {
+        while (pending.size() > keep) {
+            PendingEntry file = std::move(pending.front());
+            pending.pop_front();
+            CompressedEntry entry = file.Result.get();
+            ZipStream.putRawEntry(
+                file.FileName,
+                entry.data.data(),
+                static_cast<zipios::uint32>(entry.data.size()),
+                entry.method,
+                entry.size,
+                entry.crc
+            );
+            Writer::checkErrNo();
+        }
+    };
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        Writer::putNextEntry(entry.FileName.c_str());
+        indent = 0;
+        indBuf[0] = 0;
+
+        // SaveDocFile() is not thread safe, only the compression is done in parallel
+        EntryStream.str(std::string());
+        EntryStream.clear();
+        buffered = true;
+        try {
+            entry.Object->SaveDocFile(*this);
+        }
+        catch (...) {
+            buffered = false;
+            throw;
+        }
+        buffered = false;
+
+        pending.push_back(PendingEntry {
+            entry.FileName,
+            std::async(std::launch::async, compressEntry, std::move(EntryStream).str(), level)
+        });
+        writePending(maxPending);
+        index++;
+    }
+    writePending(0);
+}
+
+void ZipWriter::writeFilesSerial()
 {
     // use a while loop because it is possible that while
     // processing the files new ones can be added
@@ -208,10 +208,19 @@ public:
     explicit ZipWriter(std::ostream&);
     ~ZipWriter() override;
 
+    /** Write the requested files
+     * The content of the files is produced one by one, but it is compressed
+     * on worker threads and the compressed files are then written in order.
+     * A file that barely compresses is stored without compression.
+     * @see setThreads()
+     */
     void writeFiles() override;
 
     std::ostream& Stream() override
     {
+        if (buffered) {
+            return EntryStream;
+        }
         return ZipStream;
     }
 
@@ -219,9 +228,18 @@ public:
     {
         ZipStream.setComment(str);
     }
+    /// Set the compression level, 0 stores the files without compression
     void setLevel(int level)
     {
         ZipStream.setLevel(level);
+        this->level = level;
+    }
+    /** Set the number of threads used by writeFiles() to compress the files
+     * 0 uses the number of cores, 1 compresses the files one by one.
+     */
+    void setThreads(int threads)
+    {
+        this->threads = threads;
     }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
@@ -230,8 +248,15 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesSerial();
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostringstream EntryStream;
+    bool buffered {false};
+    int level {6};
+    int threads {0};
 };
 
 /** The StringWriter class
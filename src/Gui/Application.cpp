@@ -1030,6 +1030,11 @@ void Application::slotNewDocument(const App::Document& Doc, bool isMainDoc)
     // NOLINTBEGIN
     //  connect the signals to the application for the new document
     pDoc->signalNewObject.connect(std::bind(&Gui::Application::slotNewObject, this, sp::_1));
+    pDoc->signalNewObjects.connect([this](const std::vector<ViewProviderDocumentObject*>& vps) {
+        for (auto vp : vps) {
+            slotNewObject(*vp);
+        }
+    });
     pDoc->signalDeletedObject.connect(std::bind(&Gui::Application::slotDeletedObject, this, sp::_1));
     pDoc->signalChangedObject.connect(
         std::bind(&Gui::Application::slotChangedObject, this, sp::_1, sp::_2)
@@ -189,6 +189,7 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                 // So, always force binary format because ASCII
                 // is not reentrant. See PropertyPartShape::SaveDocFile
                 writer.setMode("BinaryBrep");
+                writer.setMode("BinaryLists");
 
                 writer.putNextEntry("Document.xml");
 
@@ -211,6 +212,7 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                     if (hGrp->GetBool("SaveBinaryBrep", true)) {
                         writer.setMode("BinaryBrep");
                     }
+                    writer.setMode("BinaryLists");
 
                     writer.setComment("AutoRecovery file");
                     writer.setLevel(1);  // apparently the fastest compression
@@ -261,6 +263,13 @@ AutoSaveProperty::AutoSaveProperty(const App::Document* doc)
     documentNew = const_cast<App::Document*>(doc)->signalNewObject.connect(
         std::bind(&AutoSaveProperty::slotNewObject, this, sp::_1)
     );
+    documentNewBatch = const_cast<App::Document*>(doc)->signalNewObjects.connect(
+        [this](const std::vector<App::DocumentObject*>& objs) {
+            for (auto obj : objs) {
+                slotNewObject(*obj);
+            }
+        }
+    );
     documentMod = const_cast<App::Document*>(doc)->signalChangedObject.connect(
         std::bind(&AutoSaveProperty::slotChangePropertyData, this, sp::_2)
     );
@@ -270,6 +279,7 @@ AutoSaveProperty::AutoSaveProperty(const App::Document* doc)
 AutoSaveProperty::~AutoSaveProperty()
 {
     documentNew.disconnect();
+    documentNewBatch.disconnect();
     documentMod.disconnect();
 }
 
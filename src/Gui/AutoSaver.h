@@ -58,6 +58,7 @@ private:
     void slotChangePropertyData(const App::Property&);
     using Connection = fastsignals::connection;
     Connection documentNew;
+    Connection documentNewBatch;
     Connection documentMod;
 };
 
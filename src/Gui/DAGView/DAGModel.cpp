@@ -135,6 +135,13 @@ Model::Model(QObject* parentIn, const Gui::Document& documentIn)
     connectNewObject = documentIn.signalNewObject.connect(
         std::bind(&Model::slotNewObject, this, sp::_1)
     );
+    connectNewObjects = documentIn.signalNewObjects.connect(
+        [this](const std::vector<Gui::ViewProviderDocumentObject*>& vps) {
+            for (auto vp : vps) {
+                slotNewObject(*vp);
+            }
+        }
+    );
     connectDelObject = documentIn.signalDeletedObject.connect(
         std::bind(&Model::slotDeleteObject, this, sp::_1)
     );
@@ -160,6 +167,9 @@ Model::~Model()
     if (connectNewObject.connected()) {
         connectNewObject.disconnect();
     }
+    if (connectNewObjects.connected()) {
+        connectNewObjects.disconnect();
+    }
     if (connectDelObject.connected()) {
         connectDelObject.disconnect();
     }
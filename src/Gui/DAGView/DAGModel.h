@@ -89,6 +89,7 @@ private:
     // documentObject slots.
     using Connection = fastsignals::connection;
     Connection connectNewObject;
+    Connection connectNewObjects;
     Connection connectDelObject;
     Connection connectChgObject;
     Connection connectRenObject;
@@ -20,6 +20,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <tuple>
 #include <memory>
 #include <list>
@@ -120,8 +121,10 @@ struct DocumentP
     using Connection = fastsignals::connection;
     using AdvancedConnection = fastsignals::advanced_connection;
     Connection connectNewObject;
+    Connection connectNewObjects;
     Connection connectDelObject;
     Connection connectCngObject;
+    Connection connectCngObjects;
     Connection connectRenObject;
     AdvancedConnection connectActObject;
     Connection connectSaveDocument;
@@ -449,12 +452,18 @@ Document::Document(App::Document* pcDocument, Application* app)
     d->connectNewObject = pcDocument->signalNewObject.connect(
         std::bind(&Gui::Document::slotNewObject, this, sp::_1)
     );
+    d->connectNewObjects = pcDocument->signalNewObjects.connect(
+        std::bind(&Gui::Document::slotNewObjects, this, sp::_1)
+    );
     d->connectDelObject = pcDocument->signalDeletedObject.connect(
         std::bind(&Gui::Document::slotDeletedObject, this, sp::_1)
     );
     d->connectCngObject = pcDocument->signalChangedObject.connect(
         std::bind(&Gui::Document::slotChangedObject, this, sp::_1, sp::_2)
     );
+    d->connectCngObjects = pcDocument->signalChangedObjects.connect(
+        std::bind(&Gui::Document::slotChangedObjects, this, sp::_1)
+    );
     d->connectRenObject = pcDocument->signalRelabelObject.connect(
         std::bind(&Gui::Document::slotRelabelObject, this, sp::_1)
     );
@@ -540,6 +549,10 @@ Document::Document(App::Document* pcDocument, Application* app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize", 20));
+        // memory limit in MB, the oldest steps are spilled to disk beyond
+        d->_pcDocument->setUndoLimit(
+            static_cast<unsigned int>(std::clamp(hGrp->GetInt("MaxUndoMemory", 0), 0L, 4095L)) << 20
+        );
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -550,8 +563,10 @@ Document::~Document()
     // disconnect everything to avoid to be double-deleted
     // in case an exception is raised somewhere
     d->connectNewObject.disconnect();
+    d->connectNewObjects.disconnect();
     d->connectDelObject.disconnect();
     d->connectCngObject.disconnect();
+    d->connectCngObjects.disconnect();
     d->connectRenObject.disconnect();
     d->connectActObject.disconnect();
     d->connectSaveDocument.disconnect();
@@ -966,6 +981,29 @@ void Document::setPos(const char* name, const Base::Matrix4D& rclMtrx)
 // Document
 //*****************************************************************************************************
 void Document::slotNewObject(const App::DocumentObject& Obj)
+{
+    if (auto pcProvider = attachNewObject(Obj)) {
+        // adding to the tree
+        signalNewObject(*pcProvider);
+    }
+}
+
+void Document::slotNewObjects(const std::vector<App::DocumentObject*>& objs)
+{
+    std::vector<ViewProviderDocumentObject*> providers;
+    providers.reserve(objs.size());
+    for (auto obj : objs) {
+        if (auto pcProvider = attachNewObject(*obj)) {
+            providers.push_back(pcProvider);
+        }
+    }
+    if (!providers.empty()) {
+        // adding to the tree
+        signalNewObjects(providers);
+    }
+}
+
+ViewProviderDocumentObject* Document::attachNewObject(const App::DocumentObject& Obj)
 {
     auto pcProvider = static_cast<ViewProviderDocumentObject*>(getViewProvider(&Obj));
     if (!pcProvider) {
@@ -974,7 +1012,7 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
             if (cName.empty()) {
                 // handle document object with no view provider specified
                 FC_LOG(Obj.getFullName() << " has no view provider specified");
-                return;
+                return nullptr;
             }
             Base::Type type = Base::Type::getTypeIfDerivedFrom(
                 cName.c_str(),
@@ -986,7 +1024,7 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
             if (!pcProvider) {
                 // type not derived from ViewProviderDocumentObject!!!
                 FC_ERR("Invalid view provider type '" << cName << "' for " << Obj.getFullName());
-                return;
+                return nullptr;
             }
             else if (cName != Obj.getViewProviderName() && !pcProvider->allowOverride(Obj)) {
                 FC_WARN("View provider type '" << cName << "' does not support " << Obj.getFullName());
@@ -1042,8 +1080,6 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
             }
         }
 
-        // adding to the tree
-        signalNewObject(*pcProvider);
         pcProvider->pcDocument = this;
 
         // it is possible that a new viewprovider already claims children
@@ -1052,6 +1088,7 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
             d->_redoViewProviders.push_back(pcProvider);
         }
     }
+    return pcProvider;
 }
 
 void Document::slotDeletedObject(const App::DocumentObject& Obj)
@@ -1111,6 +1148,26 @@ void Document::beforeDelete()
 }
 
 void Document::slotChangedObject(const App::DocumentObject& Obj, const App::Property& Prop)
+{
+    if (d->_pcDocument->isCoalescingChanges()) {
+        // Updated once when coalescing ends, see slotChangedObjects()
+        return;
+    }
+    updateChangedObject(Obj, Prop);
+    getMainWindow()->updateActions(true);
+}
+
+void Document::slotChangedObjects(
+    const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>& changes
+)
+{
+    for (const auto& [obj, prop] : changes) {
+        updateChangedObject(*obj, *prop);
+    }
+    getMainWindow()->updateActions(true);
+}
+
+void Document::updateChangedObject(const App::DocumentObject& Obj, const App::Property& Prop)
 {
     ViewProvider* viewProvider = getViewProvider(&Obj);
     if (viewProvider) {
@@ -1155,8 +1212,6 @@ void Document::slotChangedObject(const App::DocumentObject& Obj, const App::Prop
         FC_LOG(Prop.getFullName() << " modified");
         setModified(true);
     }
-
-    getMainWindow()->updateActions(true);
 }
 
 void Document::slotRelabelObject(const App::DocumentObject& Obj)
@@ -86,8 +86,12 @@ protected:
     //@{
     /// This slot is connected to the App::Document::signalNewObject(...)
     void slotNewObject(const App::DocumentObject&);
+    void slotNewObjects(const std::vector<App::DocumentObject*>&);
     void slotDeletedObject(const App::DocumentObject&);
     void slotChangedObject(const App::DocumentObject&, const App::Property&);
+    void slotChangedObjects(
+        const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>&
+    );
     void slotRelabelObject(const App::DocumentObject&);
     void slotTransactionAppend(const App::DocumentObject&, App::Transaction*);
     void slotTransactionRemove(const App::DocumentObject&, App::Transaction*);
@@ -113,6 +117,9 @@ public:
     //@{
     /// signal on new Object
     mutable fastsignals::signal<void(const Gui::ViewProviderDocumentObject&)> signalNewObject;
+    /// signal on new objects added in a batch, see App::Document::beginBatch()
+    mutable fastsignals::signal<void(const std::vector<Gui::ViewProviderDocumentObject*>&)>
+        signalNewObjects;
     /// signal on deleted Object
     mutable fastsignals::signal<void(const Gui::ViewProviderDocumentObject&)> signalDeletedObject;
     /** signal on changed Object, the 2nd argument is the changed property
@@ -348,6 +355,10 @@ private:
     void resetIfEditing();
     // handles the scene graph nodes to correctly group child and parents
     void handleChildren3D(ViewProvider* viewProvider, bool deleting = false);
+    /// Create or reattach the view provider of a new object
+    ViewProviderDocumentObject* attachNewObject(const App::DocumentObject& Obj);
+    /// Update the view provider of a changed object
+    void updateChangedObject(const App::DocumentObject& Obj, const App::Property& Prop);
 
     /// Check other documents for the same transaction ID
     bool checkTransactionID(bool undo, int iSteps);
@@ -425,6 +425,11 @@ void DocumentModel::slotNewDocument(const Gui::Document& Doc)
 {
     // NOLINTBEGIN
     Doc.signalNewObject.connect(std::bind(&DocumentModel::slotNewObject, this, sp::_1));
+    Doc.signalNewObjects.connect([this](const std::vector<ViewProviderDocumentObject*>& vps) {
+        for (auto vp : vps) {
+            slotNewObject(*vp);
+        }
+    });
     Doc.signalDeletedObject.connect(std::bind(&DocumentModel::slotDeleteObject, this, sp::_1));
     Doc.signalChangedObject.connect(std::bind(&DocumentModel::slotChangeObject, this, sp::_1, sp::_2));
     Doc.signalRelabelObject.connect(std::bind(&DocumentModel::slotRenameObject, this, sp::_1));
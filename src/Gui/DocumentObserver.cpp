@@ -312,6 +312,7 @@ public:
     {
         connectApplicationDeletedDocument.disconnect();
         connectDocumentCreatedObject.disconnect();
+        connectDocumentCreatedObjects.disconnect();
         connectDocumentDeletedObject.disconnect();
         object = nullptr;
         indocument = false;
@@ -330,6 +331,13 @@ public:
                 connectDocumentCreatedObject = doc->signalNewObject.connect(
                     std::bind(&Private::createdObject, this, sp::_1)
                 );
+                connectDocumentCreatedObjects = doc->signalNewObjects.connect(
+                    [this](const std::vector<ViewProviderDocumentObject*>& vps) {
+                        for (auto vp : vps) {
+                            createdObject(*vp);
+                        }
+                    }
+                );
                 connectDocumentDeletedObject = doc->signalDeletedObject.connect(
                     std::bind(&Private::deletedObject, this, sp::_1)
                 );
@@ -352,6 +360,7 @@ public:
     using Connection = fastsignals::scoped_connection;
     Connection connectApplicationDeletedDocument;
     Connection connectDocumentCreatedObject;
+    Connection connectDocumentCreatedObjects;
     Connection connectDocumentDeletedObject;
 };
 
@@ -430,6 +439,13 @@ void DocumentObserver::attachDocument(Document* doc)
     this->connectDocumentCreatedObject = doc->signalNewObject.connect(
         std::bind(&DocumentObserver::slotCreatedObject, this, sp::_1)
     );
+    this->connectDocumentCreatedObjects = doc->signalNewObjects.connect(
+        [this](const std::vector<ViewProviderDocumentObject*>& vps) {
+            for (auto vp : vps) {
+                slotCreatedObject(*vp);
+            }
+        }
+    );
     this->connectDocumentDeletedObject = doc->signalDeletedObject.connect(
         std::bind(&DocumentObserver::slotDeletedObject, this, sp::_1)
     );
@@ -463,6 +479,7 @@ void DocumentObserver::attachDocument(Document* doc)
 void DocumentObserver::detachDocument()
 {
     this->connectDocumentCreatedObject.disconnect();
+    this->connectDocumentCreatedObjects.disconnect();
     this->connectDocumentDeletedObject.disconnect();
     this->connectDocumentChangedObject.disconnect();
     this->connectDocumentRelabelObject.disconnect();
@@ -372,6 +372,7 @@ private:
 private:
     using Connection = fastsignals::scoped_connection;
     Connection connectDocumentCreatedObject;
+    Connection connectDocumentCreatedObjects;
     Connection connectDocumentDeletedObject;
     Connection connectDocumentChangedObject;
     Connection connectDocumentRelabelObject;
@@ -918,6 +918,12 @@ void ReportOutput::OnChange(Base::Subject<const char*>& rCaller, const char* sRe
     else if (strcmp(sReason, "checkGoToEnd") == 0) {
         gotoEnd = rclGrp.GetBool(sReason, gotoEnd);
     }
+    else if (strcmp(sReason, "AsyncLogging") == 0) {
+        Base::Console().setConnectionMode(
+            rclGrp.GetBool(sReason, false) ? Base::ConsoleSingleton::Async
+                                           : Base::ConsoleSingleton::Direct
+        );
+    }
     else if (strcmp(sReason, "FontSize") == 0 || strcmp(sReason, "Font") == 0) {
         int fontSize = rclGrp.GetInt("FontSize", 10);
         QFont font;
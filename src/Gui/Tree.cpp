@@ -4247,6 +4247,9 @@ DocumentItem::DocumentItem(const Gui::Document* doc, QTreeWidgetItem* parent)
     connectNewObject = doc->signalNewObject.connect(
         std::bind(&DocumentItem::slotNewObject, this, sp::_1)
     );
+    connectNewObjects = doc->signalNewObjects.connect(
+        std::bind(&DocumentItem::slotNewObjects, this, sp::_1)
+    );
     connectDelObject = doc->signalDeletedObject.connect(
         std::bind(&TreeWidget::slotDeleteObject, getTree(), sp::_1)
     );
@@ -4288,6 +4291,7 @@ DocumentItem::DocumentItem(const Gui::Document* doc, QTreeWidgetItem* parent)
 DocumentItem::~DocumentItem()
 {
     connectNewObject.disconnect();
+    connectNewObjects.disconnect();
     connectDelObject.disconnect();
     connectChgObject.disconnect();
     connectTouchedObject.disconnect();
@@ -4389,6 +4393,18 @@ void DocumentItem::slotNewObject(const Gui::ViewProviderDocumentObject& obj)
     getTree()->_updateStatus();
 }
 
+void DocumentItem::slotNewObjects(const std::vector<Gui::ViewProviderDocumentObject*>& objs)
+{
+    auto& ids = getTree()->NewObjects[pDocument->getDocument()->getName()];
+    ids.reserve(ids.size() + objs.size());
+    for (auto obj : objs) {
+        if (obj->getObject() && obj->getObject()->isAttachedToDocument()) {
+            ids.push_back(obj->getObject()->getID());
+        }
+    }
+    getTree()->_updateStatus();
+}
+
 bool DocumentItem::createNewItem(
     const Gui::ViewProviderDocumentObject& obj,
     QTreeWidgetItem* parent,
@@ -366,6 +366,8 @@ protected:
      * If this view provider is already added nothing happens.
      */
     void slotNewObject(const Gui::ViewProviderDocumentObject&);
+    /// Adds the view providers of objects created in a batch at once
+    void slotNewObjects(const std::vector<Gui::ViewProviderDocumentObject*>&);
     /** Removes a view provider from the document item.
      * If this view provider is not added nothing happens.
      */
@@ -432,6 +434,7 @@ private:
 
     using Connection = fastsignals::connection;
     Connection connectNewObject;
+    Connection connectNewObjects;
     Connection connectDelObject;
     Connection connectChgObject;
     Connection connectTouchedObject;
@@ -528,7 +528,14 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
-    _kernel.Read(in);
+    MeshCore::MeshKernel kernel;
+    kernel.Read(in);
+    load(kernel);
+}
+
+void MeshObject::load(MeshCore::MeshKernel& kernel)
+{
+    _kernel.Swap(kernel);
     this->_segments.clear();
 
 #ifndef FC_DEBUG
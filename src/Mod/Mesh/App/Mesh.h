@@ -221,6 +221,8 @@ public:
     // Save and load in internal format
     void save(std::ostream&) const;
     void load(std::istream&);
+    /// Take over a kernel that was read in the internal format
+    void load(MeshCore::MeshKernel& kernel);
     void writeInventor(std::ostream& str, float creaseangle = 0.0F) const;
     //@}
 
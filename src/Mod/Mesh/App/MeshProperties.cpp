@@ -931,6 +931,22 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyMeshKernel::canRestoreDocFileAsync() const
+{
+    return true;
+}
+
+std::function<void()> PropertyMeshKernel::restoreDocFileAsync(Base::Reader& reader)
+{
+    auto kernel = std::make_shared<MeshCore::MeshKernel>();
+    kernel->Read(reader);
+    return [this, kernel]() {
+        aboutToSetValue();
+        _meshObject->load(*kernel);
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
     // Note: Copy the content, do NOT reference the same mesh object
@@ -317,9 +317,15 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileAsync() const override;
+    std::function<void()> restoreDocFileAsync(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
+    bool isCopyOwningData() const override
+    {
+        return true;
+    }
     //@}
 
 private:
@@ -63,6 +63,10 @@ public:
     }
 
 protected:
+    bool canCacheResult() const override
+    {
+        return true;
+    }
     virtual BRepAlgoAPI_BooleanOperation* makeOperation(const TopoDS_Shape&, const TopoDS_Shape&) const
         = 0;
     virtual const char* opCode() const = 0;
@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <QCryptographicHash>
+
+#include <gp_Trsf.hxx>
+
+#include <App/Application.h>
+#include <App/ComplexGeoData.h>
+#include <App/Document.h>
+#include <Base/Console.h>
+#include <Base/Parameter.h>
+#include <Base/Writer.h>
+
+#include "FeatureResultCache.h"
+#include "PartFeature.h"
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+FeatureResultCache::FeatureResultCache()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    // in MB
+    budget = static_cast<std::size_t>(std::max(0L, hGrp->GetInt("ResultCacheSize", 256))) << 20;
+
+    // NOLINTBEGIN
+    connDeleteDocument = App::GetApplication().signalDeleteDocument.connect(
+        [this](const App::Document& doc) { clear(&doc); }
+    );
+    // NOLINTEND
+}
+
+FeatureResultCache& FeatureResultCache::instance()
+{
+    static FeatureResultCache cache;
+    return cache;
+}
+
+bool FeatureResultCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget > 0;
+}
+
+bool FeatureResultCache::makeKey(
+    const Feature* feature,
+    std::string& key,
+    std::vector<TopoShape>& inputs
+)
+{
+    Base::StringWriter writer;
+    writer.setForceXML(true);
+    auto& stream = writer.Stream();
+    stream.precision(17);
+    stream << feature->getTypeId().getName() << ' ' << feature->getFullName() << ' '
+           << feature->getID() << '\n';
+    // See Feature::copyMaterial()
+    stream << "material " << feature->ShapeMaterial.getValue().getUUID().toStdString() << '\n';
+
+    std::vector<App::Property*> props;
+    feature->getPropertyList(props);
+    try {
+        for (auto prop : props) {
+            // Skip the output and the properties that do not affect the shape.
+            // The upstream shapes are identified below.
+            if (prop == &feature->Shape || prop == &feature->Label || prop == &feature->Label2
+                || prop == &feature->Visibility || prop == &feature->ExpressionEngine
+                || prop == &feature->ShapeMaterial || (prop->getType() & App::Prop_Output)
+                || prop->testStatus(App::Property::Output)
+                || prop->isDerivedFrom<App::PropertyComplexGeoData>()) {
+                continue;
+            }
+            stream << prop->getName() << '\n';
+            prop->Save(writer);
+        }
+    }
+    catch (Base::Exception& e) {
+        FC_LOG("Cannot key " << feature->getFullName() << ": " << e.what());
+        return false;
+    }
+
+    inputs.clear();
+    for (auto dep : feature->getOutList()) {
+        if (!dep || !dep->isAttachedToDocument()) {
+            continue;
+        }
+        auto shape = Feature::getTopoShape(dep, ShapeOption::ResolveLink | ShapeOption::Transform);
+        stream << "dep " << dep->getFullName() << ' ';
+        if (auto depFeature = freecad_cast<Feature*>(dep)) {
+            stream << depFeature->ShapeMaterial.getValue().getUUID().toStdString() << ' ';
+        }
+        if (shape.isNull()) {
+            stream << "null\n";
+            continue;
+        }
+        const TopoDS_Shape& s = shape.getShape();
+        const gp_Trsf trsf = s.Location().Transformation();
+        stream << static_cast<const void*>(s.TShape().get()) << ' ' << s.Orientation() << ' '
+               << shape.Tag << ' ' << shape.getElementMapSize(false);
+        for (int row = 1; row <= 3; ++row) {
+            for (int col = 1; col <= 4; ++col) {
+                stream << ' ' << trsf.Value(row, col);
+            }
+        }
+        stream << '\n';
+        inputs.push_back(std::move(shape));
+    }
+
+    QByteArray digest = QCryptographicHash::hash(
+        QByteArray::fromStdString(writer.getString()),
+        QCryptographicHash::Sha256
+    );
+    key = digest.toStdString();
+    return true;
+}
+
+bool FeatureResultCache::restore(Feature* feature, const std::string& key)
+{
+    TopoShape result;
+    std::shared_ptr<App::Property> material;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        result = it->second->result;
+        material = it->second->material;
+    }
+    FC_LOG("Restore cached result of " << feature->getFullName());
+    feature->Shape.setValue(result);
+    auto& mat = static_cast<const Materials::PropertyMaterial&>(*material).getValue();
+    if (feature->ShapeMaterial.getValue().getUUID() != mat.getUUID()) {
+        feature->ShapeMaterial.setValue(mat);
+    }
+    return true;
+}
+
+void FeatureResultCache::store(
+    const Feature* feature,
+    const std::string& key,
+    std::vector<TopoShape> inputs
+)
+{
+    const TopoShape& result = feature->Shape.getShape();
+    std::size_t size = result.isNull() ? 0 : result.getMemSize();
+    std::shared_ptr<App::Property> material(feature->ShapeMaterial.Copy());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        used -= it->second->size;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    if (result.isNull() || size > budget) {
+        return;
+    }
+    entries.push_front(
+        Entry {key, feature->getDocument(), result, std::move(material), std::move(inputs), size}
+    );
+    index.emplace(key, entries.begin());
+    used += size;
+    evict();
+}
+
+void FeatureResultCache::clear(const App::Document* doc)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (doc && it->document != doc) {
+            ++it;
+            continue;
+        }
+        used -= it->size;
+        index.erase(it->key);
+        it = entries.erase(it);
+    }
+}
+
+void FeatureResultCache::setBudget(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    budget = bytes;
+    evict();
+}
+
+std::size_t FeatureResultCache::getBudget() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget;
+}
+
+void FeatureResultCache::evict()
+{
+    while (used > budget && !entries.empty()) {
+        used -= entries.back().size;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
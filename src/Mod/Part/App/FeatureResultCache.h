@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PART_FEATURERESULTCACHE_H
+#define PART_FEATURERESULTCACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastsignals/signal.h>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace App
+{
+class Document;
+class Property;
+}
+
+namespace Part
+{
+
+class Feature;
+
+/** A bounded cache of feature results keyed by the feature inputs
+ *
+ * The key of a result is a digest of the input property values of a feature
+ * together with the identity of its upstream shapes. When a feature is
+ * recomputed with inputs that were seen before, e.g. when toggling a
+ * parameter back and forth or on undo, the cached shape including its element
+ * map is restored instead of calling execute(). The material of the feature
+ * is restored as well, as execute() may copy it from an upstream feature, so
+ * the materials of the feature and its upstream features are keyed too.
+ *
+ * Upstream shapes are identified by their underlying TopoDS_TShape. The cache
+ * holds on to the upstream shapes of each entry, so that their identity cannot
+ * be reused by another shape while the entry lives.
+ *
+ * The cache may be used by features recomputed on several threads at once.
+ */
+class PartExport FeatureResultCache
+{
+public:
+    static FeatureResultCache& instance();
+
+    /// Check whether the cache is enabled, i.e. has a non zero memory budget
+    bool isEnabled() const;
+
+    /** Compute the cache key of a feature
+     *
+     * @param feature: the feature about to be recomputed
+     * @param key: returns the key
+     * @param inputs: returns the upstream shapes identified by the key
+     *
+     * @return Returns false if the inputs of the feature cannot be keyed
+     */
+    static bool makeKey(const Feature* feature, std::string& key, std::vector<TopoShape>& inputs);
+
+    /** Restore the cached result of a feature
+     * @return Returns true if the key is found and the result is restored
+     */
+    bool restore(Feature* feature, const std::string& key);
+
+    /// Store the current result of a feature
+    void store(const Feature* feature, const std::string& key, std::vector<TopoShape> inputs);
+
+    /// Remove all entries, or only the entries of the given document
+    void clear(const App::Document* doc = nullptr);
+
+    /// Set the memory budget in bytes, zero disables the cache
+    void setBudget(std::size_t bytes);
+
+    /// Return the memory budget in bytes
+    std::size_t getBudget() const;
+
+private:
+    FeatureResultCache();
+    void evict();
+
+    struct Entry
+    {
+        std::string key;
+        const App::Document* document;
+        TopoShape result;
+        std::shared_ptr<App::Property> material;
+        std::vector<TopoShape> inputs;
+        std::size_t size;
+    };
+    std::list<Entry> entries;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t budget;
+    std::size_t used {0};
+    mutable std::mutex mutex;
+    fastsignals::scoped_connection connDeleteDocument;
+};
+
+}  // namespace Part
+
+#endif  // PART_FEATURERESULTCACHE_H
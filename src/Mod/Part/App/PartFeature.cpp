@@ -72,6 +72,7 @@
 #include <Base/Tools.h>
 #include <Mod/Material/App/MaterialManager.h>
 
+#include "FeatureResultCache.h"
 #include "Geometry.h"
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
@@ -104,7 +105,19 @@ short Feature::mustExecute() const
 App::DocumentObjectExecReturn* Feature::recompute()
 {
     try {
-        return App::GeoFeature::recompute();
+        auto& cache = FeatureResultCache::instance();
+        std::string key;
+        std::vector<TopoShape> inputs;
+        bool cacheable = canCacheResult() && cache.isEnabled()
+            && FeatureResultCache::makeKey(this, key, inputs);
+        if (cacheable && cache.restore(this, key)) {
+            return executeExtensions();
+        }
+        auto ret = App::GeoFeature::recompute();
+        if (cacheable && ret == App::DocumentObject::StdReturn) {
+            cache.store(this, key, std::move(inputs));
+        }
+        return ret;
     }
     catch (Standard_Failure& e) {
 
@@ -1534,9 +1547,10 @@ void Feature::onChanged(const App::Property* prop)
     // if the point data has changed check and adjust the transformation as well
     else if (prop == &this->Shape) {
         if (this->isRecomputing()) {
-            this->Shape._Shape.setTransform(this->Placement.getValue().toMatrix());
+            this->Shape.setTransform(this->Placement.getValue().toMatrix());
         }
-        else {
+        // a deferred shape is restored with the placement saved along with it
+        else if (!this->Shape.isShapeDeferred()) {
             Base::Placement p;
             // shape must not be null to override the placement
             if (!this->Shape.getValue().IsNull()) {
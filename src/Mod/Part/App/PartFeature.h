@@ -211,6 +211,18 @@ public:
     ) const override;
 
 protected:
+    /** Check whether the result of this feature can be cached
+     *
+     * A feature returning true here has its result restored from the
+     * FeatureResultCache when recomputed with inputs seen before. It must
+     * only change Shape on execute(), and the result must only depend on its
+     * own property values and the shapes of the linked objects.
+     */
+    virtual bool canCacheResult() const
+    {
+        return false;
+    }
+
     /// recompute only this object
     App::DocumentObjectExecReturn* recompute() override;
     /// recalculate the feature
@@ -272,6 +284,10 @@ public:
     void onUpdateElementReference(const App::Property* prop) override;
 
 protected:
+    bool canCacheResult() const override
+    {
+        return true;
+    }
     void onDocumentRestored() override;
     void onChanged(const App::Property*) override;
     void syncEdgeLink();
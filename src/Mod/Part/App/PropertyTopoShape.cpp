@@ -48,6 +48,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PropertyTopoShape.h"
+#include "ShapeFileCache.h"
 #include "TopoShapePy.h"
 #include "PartFeature.h"
 
@@ -65,6 +66,14 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    assignShape(sh);
+    hasSetValue();
+    _Ver.clear();
+}
+
+void PropertyPartShape::assignShape(const TopoShape& sh)
+{
+    _DeferredData.reset();
     _Shape = sh;
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if (obj) {
@@ -88,13 +97,12 @@ void PropertyPartShape::setValue(const TopoShape& sh)
             _Shape.hashChildMaps();
         }
     }
-    hasSetValue();
-    _Ver.clear();
 }
 
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    _DeferredData.reset();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if (obj) {
         _Shape.Tag = obj->getID();
@@ -106,11 +114,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    loadDeferredShape();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    loadDeferredShape();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -127,6 +137,7 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    loadDeferredShape();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
@@ -134,6 +145,7 @@ const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
     Base::BoundBox3d box;
+    loadDeferredShape();
     if (_Shape.getShape().IsNull()) {
         return box;
     }
@@ -160,16 +172,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D& rclTrf)
 {
+    loadDeferredShape();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    loadDeferredShape();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 {
+    loadDeferredShape();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -177,6 +192,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 
 PyObject* PropertyPartShape::getPyObject()
 {
+    loadDeferredShape();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop) {
         prop->setConst();
@@ -224,6 +240,7 @@ App::Property* PropertyPartShape::Copy() const
     //        prop->_Shape = this->_Shape.makeElementCopy();
     //    } else
     //        prop->_Shape = this->_Shape;
+    loadDeferredShape();
     prop->_Shape = this->_Shape;
     prop->_Ver = this->_Ver;
     return prop;
@@ -233,6 +250,7 @@ void PropertyPartShape::Paste(const App::Property& from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if (prop) {
+        prop->loadDeferredShape();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -240,6 +258,9 @@ void PropertyPartShape::Paste(const App::Property& from)
 
 unsigned int PropertyPartShape::getMemSize() const
 {
+    if (_DeferredData) {
+        return static_cast<unsigned int>(_DeferredData->size());
+    }
     return _Shape.getMemSize();
 }
 
@@ -349,12 +370,18 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier>& paths) cons
     );
 }
 
+bool PropertyPartShape::hasShape() const
+{
+    // A deferred shape keeps its restored element map in _Shape, see RestoreDocFile()
+    return _DeferredData || !_Shape.isNull();
+}
+
 void PropertyPartShape::beforeSave() const
 {
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
-    if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0) {
+    if (owner && hasShape() && _Shape.getElementMapSize() > 0) {
         auto ret = owner->getDocument()->addStringHasher(_Shape.Hasher);
         _HasherIndex = ret.second;
         _SaveHasher = ret.first;
@@ -364,9 +391,13 @@ void PropertyPartShape::beforeSave() const
 void PropertyPartShape::Save(Base::Writer& writer) const
 {
     // See SaveDocFile(), RestoreDocFile()
+    bool toXML = writer.isForceXML();
+    if (toXML) {
+        loadDeferredShape();
+    }
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
-    if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
+    if (owner && hasShape() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
         writer.Stream() << " HasherIndex=\"" << _HasherIndex << '"';
         if (_SaveHasher) {
             writer.Stream() << " SaveHasher=\"1\"";
@@ -386,11 +417,16 @@ void PropertyPartShape::Save(Base::Writer& writer) const
     writer.Stream() << " ElementMap=\"" << version << '"';
 
     bool binary = writer.getMode("BinaryBrep");
-    bool toXML = writer.isForceXML();
+    if (_DeferredData) {
+        // The deferred content is written as is, see SaveDocFile()
+        binary = Base::FileInfo(_DeferredFile).hasExtension("bin");
+    }
     if (!toXML) {
-        writer.Stream() << " file=\""
-                        << writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this)
-                        << "\"/>\n";
+        std::string file = writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this);
+        writer.Stream() << " file=\"" << file << "\"/>\n";
+        if (owner && !owner->isExporting() && !_DeferredData) {
+            ShapeFileCache::instance().storeOnSave(owner->getDocument(), file, _Shape.getShape());
+        }
     }
     else if (binary) {
         writer.Stream() << " binary=\"1\">\n";
@@ -434,6 +470,7 @@ std::string PropertyPartShape::getElementMapVersion(bool restored) const
 void PropertyPartShape::Restore(Base::XMLReader& reader)
 {
     reader.readElement("Part");
+    _DeferredData.reset();
 
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
     _Ver = "?";
@@ -447,11 +484,13 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
 
     TopoShape shape;
 
+    _Archive.clear();
     if (reader.hasAttribute("file")) {
         std::string file = reader.getAttribute<const char*>("file");
         if (!file.empty()) {
             // initiate a file read
             reader.addFile(file.c_str(), this);
+            _Archive = reader.getFileName();
         }
     }
     else if (reader.hasAttribute(("binary")) && reader.getAttribute<long>("binary")) {
@@ -544,6 +583,20 @@ void PropertyPartShape::afterRestore()
             _Shape.Hasher->clear();
         }
     }
+    if (_DeferredData) {
+        // Same as PropertyComplexGeoData::afterRestore() but without calling
+        // getComplexData(), which would parse the deferred shape.
+        if (_Shape.isRestoreFailed()) {
+            _Shape.resetRestoreFailure();
+            auto owner = freecad_cast<App::DocumentObject*>(getContainer());
+            if (owner && owner->getDocument()
+                && !owner->getDocument()->testStatus(App::Document::PartialDoc)) {
+                owner->getDocument()->addRecomputeObject(owner);
+            }
+        }
+        App::PropertyGeometry::afterRestore();
+        return;
+    }
     PropertyComplexGeoData::afterRestore();
 }
 
@@ -705,6 +758,12 @@ void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
 {
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
+    if (_DeferredData) {
+        // Saving does not need the shape parsed, Save() has chosen the file
+        // type of the deferred content
+        writer.Stream().write(_DeferredData->data(), std::streamsize(_DeferredData->size()));
+        return;
+    }
     if (_Shape.getShape().IsNull()) {
         return;
     }
@@ -729,14 +788,98 @@ void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+namespace
+{
+bool isLazyLoading()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("LazyLoadShapes", false);
+}
+
+bool isDirectAccess()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("DirectAccess", true);
+}
+
+// Parse a shape file written by PropertyPartShape::SaveDocFile() without
+// touching any document state
+TopoShape readShapeFile(Base::Reader& reader, bool& failed)
+{
+    TopoShape shape;
+    failed = false;
+    if (Base::FileInfo(reader.getFileName()).hasExtension("bin")) {
+        shape.importBinary(reader);
+        return shape;
+    }
+    TopoDS_Shape brepShape;
+    try {
+        reader.exceptions(std::istream::failbit | std::istream::badbit);
+        BRep_Builder builder;
+        BRepTools::Read(brepShape, reader, builder);
+    }
+    catch (const std::exception&) {
+        failed = !reader.eof();
+    }
+    if (!brepShape.IsNull()) {
+        shape.setShape(brepShape);
+    }
+    return shape;
+}
+
+// Same as readShapeFile() but takes the shape from ShapeFileCache if the
+// document file is unchanged since it was read or written before
+TopoShape readShapeFile(const std::string& archive, Base::Reader& reader, bool& failed)
+{
+    auto& cache = ShapeFileCache::instance();
+    TopoDS_Shape cached;
+    if (cache.find(archive, reader.getFileName(), cached)) {
+        failed = false;
+        TopoShape shape;
+        shape.setShape(cached);
+        return shape;
+    }
+    TopoShape shape = readShapeFile(reader, failed);
+    if (!failed) {
+        cache.store(archive, reader.getFileName(), shape.getShape());
+    }
+    return shape;
+}
+}  // namespace
+
 void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
 {
+    Base::FileInfo brep(reader.getFileName());
+    TopoDS_Shape cached;
+    if (ShapeFileCache::instance().find(_Archive, reader.getFileName(), cached)) {
+        // Taking the shape from the cache is cheaper than parsing or deferring it
+        _DeferredData.reset();
+        TopoShape shape;
+        shape.setShape(cached);
+        applyShapeFile(shape, true);
+        return;
+    }
+    if (isLazyLoading() && (brep.hasExtension("bin") || isDirectAccess())) {
+        // Only keep the file content here and parse it on first access, see
+        // loadDeferredShape(). The element map restored by Restore() is kept
+        // in _Shape until then.
+        std::ostringstream data;
+        data << reader.rdbuf();
+        aboutToSetValue();
+        _DeferredData = std::make_unique<std::string>(std::move(data).str());
+        _DeferredFile = reader.getFileName();
+        _Deferred = true;
+        hasSetValue();
+        return;
+    }
+    _DeferredData.reset();
 
     // save the element map
     auto elementMap = _Shape.resetElementMap();
     auto hasher = _Shape.Hasher;
 
-    Base::FileInfo brep(reader.getFileName());
     TopoShape shape;
 
     // In LS3 the following statement is executed right before shape.Hasher = hasher;
@@ -752,10 +895,7 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
         shape.importBinary(reader);
     }
     else {
-        bool direct = App::GetApplication()
-                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
-                          ->GetBool("DirectAccess", true);
-        if (!direct) {
+        if (!isDirectAccess()) {
             loadFromFile(reader);
         }
         else {
@@ -766,6 +906,8 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
         shape = getValue();
     }
 
+    ShapeFileCache::instance().store(_Archive, reader.getFileName(), shape.getShape());
+
     // restore the element map
     shape.Hasher = hasher;
     shape.resetElementMap(elementMap);
@@ -773,6 +915,75 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
     _Ver = ver;
 }
 
+void PropertyPartShape::applyShapeFile(const TopoShape& parsed, bool notify)
+{
+    // restore the element map and keep the version read by Restore()
+    auto elementMap = _Shape.resetElementMap();
+    std::string ver = _Ver;
+
+    TopoShape shape = parsed;
+    shape.Hasher = _Shape.Hasher;
+    shape.resetElementMap(elementMap);
+    if (notify) {
+        setValue(shape);
+    }
+    else {
+        assignShape(shape);
+    }
+    _Ver = ver;
+}
+
+void PropertyPartShape::loadDeferredShape() const
+{
+    if (!_Deferred.load(std::memory_order_acquire)) {
+        return;
+    }
+    // The shape may be accessed by several threads at once, e.g. while recomputing
+    std::lock_guard<std::mutex> lock(_DeferredMutex);
+    if (!_DeferredData) {
+        _Deferred = false;
+        return;
+    }
+    // The shape is logically unchanged, so no change is signaled here
+    auto data = std::move(_DeferredData);
+    std::istringstream stream(std::move(*data));
+    Base::Reader reader(stream, _DeferredFile, 0);
+    bool failed = false;
+    TopoShape shape = readShapeFile(reader, failed);
+    if (failed) {
+        Base::Console().warning("Failed to load BRep file %s\n", _DeferredFile.c_str());
+    }
+    else {
+        ShapeFileCache::instance().store(_Archive, _DeferredFile, shape.getShape());
+    }
+    FC_LOG("Load deferred shape of " << getFullName());
+    const_cast<PropertyPartShape*>(this)->applyShapeFile(shape, false);
+    _Deferred.store(false, std::memory_order_release);
+}
+
+bool PropertyPartShape::canRestoreDocFileAsync() const
+{
+    // Deferring the shape is cheaper than parsing it. The temporary file used
+    // without direct access is shared, so read from the stream only.
+    return !isLazyLoading() && isDirectAccess();
+}
+
+std::function<void()> PropertyPartShape::restoreDocFileAsync(Base::Reader& reader)
+{
+    // Runs on a worker thread, so only parse the shape here. The element map
+    // and the hasher are restored when the shape is applied.
+    std::string fileName = reader.getFileName();
+    bool failed = false;
+    TopoShape shape = readShapeFile(_Archive, reader, failed);
+
+    return [this, fileName, shape, failed]() {
+        if (failed) {
+            Base::Console().warning("Failed to load BRep file %s\n", fileName.c_str());
+        }
+        applyShapeFile(shape, true);
+    };
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(
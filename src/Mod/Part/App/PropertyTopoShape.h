@@ -25,7 +25,10 @@
 #ifndef PART_PROPERTYTOPOSHAPE_H
 #define PART_PROPERTYTOPOSHAPE_H
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -61,6 +64,15 @@ public:
     const TopoDS_Shape& getValue() const;
     const TopoShape& getShape() const;
     const Data::ComplexGeoData* getComplexData() const override;
+    /** Check whether the shape file of a restored document is not parsed yet
+     *
+     * If the LazyLoadShapes parameter is enabled, RestoreDocFile() only keeps
+     * the raw file content, which is parsed on the first access to the shape.
+     */
+    bool isShapeDeferred() const
+    {
+        return static_cast<bool>(_DeferredData);
+    }
     //@}
 
     /** @name Modification */
@@ -94,6 +106,8 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileAsync() const override;
+    std::function<void()> restoreDocFileAsync(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -117,10 +131,22 @@ private:
     void saveToFile(Base::Writer& writer) const;
     void loadFromFile(Base::Reader& reader);
     void loadFromStream(Base::Reader& reader);
+    void assignShape(const TopoShape& sh);
+    void applyShapeFile(const TopoShape& shape, bool notify);
+    void loadDeferredShape() const;
+    bool hasShape() const;
 
 private:
     TopoShape _Shape;
     std::string _Ver;
+    // Raw content of the shape file whose parsing is deferred, see RestoreDocFile()
+    mutable std::unique_ptr<std::string> _DeferredData;
+    std::string _DeferredFile;
+    // Set with _DeferredData, checked by loadDeferredShape() before locking _DeferredMutex
+    mutable std::atomic<bool> _Deferred {false};
+    mutable std::mutex _DeferredMutex;
+    // Path of the document file being restored, used to look up ShapeFileCache
+    std::string _Archive;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
 };
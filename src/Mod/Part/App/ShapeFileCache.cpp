@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Parameter.h>
+#include <zipios++/zipfile.h>
+
+#include "ShapeFileCache.h"
+
+using namespace Part;
+
+namespace
+{
+
+std::string makeKey(const std::string& archive, const std::string& file)
+{
+    std::string key(archive);
+    key += '\0';
+    key += file;
+    return key;
+}
+
+}  // namespace
+
+ShapeFileCache::ShapeFileCache()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    // in MB
+    budget = static_cast<std::size_t>(std::max(0L, hGrp->GetInt("ShapeFileCacheSize", 128)))
+        << 20;
+
+    // NOLINTBEGIN
+    connStartSave = App::GetApplication().signalStartSaveDocument.connect(
+        [this](const App::Document& doc, const std::string&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Also drops the shapes left by a save that failed
+            pending[&doc].clear();
+        }
+    );
+    connFinishSave = App::GetApplication().signalFinishSaveDocument.connect(
+        [this](const App::Document& doc, const std::string& fileName) {
+            std::map<std::string, TopoDS_Shape> shapes;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto it = pending.find(&doc);
+                if (it == pending.end()) {
+                    return;
+                }
+                shapes = std::move(it->second);
+                pending.erase(it);
+            }
+            for (const auto& [file, shape] : shapes) {
+                store(fileName, file, shape);
+            }
+        }
+    );
+    connDeleteDocument = App::GetApplication().signalDeleteDocument.connect(
+        [this](const App::Document& doc) {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.erase(&doc);
+        }
+    );
+    // NOLINTEND
+}
+
+ShapeFileCache& ShapeFileCache::instance()
+{
+    static ShapeFileCache cache;
+    return cache;
+}
+
+bool ShapeFileCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget > 0;
+}
+
+bool ShapeFileCache::getStamp(const std::string& archive, std::string& path, Stamp& stamp)
+{
+    // Only document files are stable enough to be identified by their path,
+    // unlike e.g. the temporary files used for undo
+    if (archive.empty() || !Base::FileInfo(archive).hasExtension("FCStd")) {
+        return false;
+    }
+    // The same file may be opened and saved under different names
+    std::error_code ec;
+    auto canonical = std::filesystem::weakly_canonical(Base::FileInfo::stringToPath(archive), ec);
+    if (ec) {
+        return false;
+    }
+    auto size = std::filesystem::file_size(canonical, ec);
+    if (ec) {
+        return false;
+    }
+    auto time = std::filesystem::last_write_time(canonical, ec);
+    if (ec) {
+        return false;
+    }
+    path = Base::FileInfo::pathToString(canonical);
+    stamp = Stamp(size, static_cast<std::int64_t>(time.time_since_epoch().count()));
+    return true;
+}
+
+bool ShapeFileCache::getFileSize(
+    const std::string& path,
+    const Stamp& stamp,
+    const std::string& file,
+    std::size_t& size
+)
+{
+    // Only the directory at the end of the document file is read, once for
+    // all the shapes of a document
+    if (directory.path != path || directory.stamp != stamp) {
+        directory.path = path;
+        directory.stamp = stamp;
+        directory.sizes.clear();
+        try {
+            zipios::ZipFile zip(path);
+            if (zip.isValid()) {
+                for (const auto& entry : zip.entries()) {
+                    directory.sizes.emplace(entry->getFileName(), entry->getSize());
+                }
+            }
+        }
+        catch (const std::exception&) {
+        }
+    }
+    auto it = directory.sizes.find(file);
+    if (it == directory.sizes.end()) {
+        return false;
+    }
+    size = it->second;
+    return true;
+}
+
+bool ShapeFileCache::find(const std::string& archive, const std::string& file, TopoDS_Shape& shape)
+{
+    std::string path;
+    Stamp stamp;
+    if (!isEnabled() || !getStamp(archive, path, stamp)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(makeKey(path, file));
+    if (it == index.end() || it->second->stamp != stamp) {
+        ++statistics.misses;
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    shape = it->second->shape;
+    ++statistics.hits;
+    return true;
+}
+
+void ShapeFileCache::store(
+    const std::string& archive,
+    const std::string& file,
+    const TopoDS_Shape& shape
+)
+{
+    std::string path;
+    Stamp stamp;
+    if (shape.IsNull() || !isEnabled() || !getStamp(archive, path, stamp)) {
+        return;
+    }
+    std::string key = makeKey(path, file);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        used -= it->second->size;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    std::size_t size = 0;
+    if (!getFileSize(path, stamp, file, size) || size > budget) {
+        return;
+    }
+    entries.push_front(Entry {key, stamp, shape, size});
+    index.emplace(key, entries.begin());
+    used += size;
+    evict();
+}
+
+void ShapeFileCache::storeOnSave(
+    const App::Document* doc,
+    const std::string& file,
+    const TopoDS_Shape& shape
+)
+{
+    if (!doc || shape.IsNull()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    // Only while saving the document to its file, see signalStartSaveDocument
+    auto it = pending.find(doc);
+    if (it != pending.end() && budget > 0) {
+        it->second[file] = shape;
+    }
+}
+
+void ShapeFileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    for (auto& [doc, shapes] : pending) {
+        shapes.clear();
+    }
+    directory = Directory();
+    used = 0;
+}
+
+void ShapeFileCache::setBudget(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    budget = bytes;
+    evict();
+}
+
+std::size_t ShapeFileCache::getBudget() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget;
+}
+
+ShapeFileCache::Statistics ShapeFileCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+void ShapeFileCache::evict()
+{
+    while (used > budget && !entries.empty()) {
+        used -= entries.back().size;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
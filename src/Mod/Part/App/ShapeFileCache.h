@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PART_SHAPEFILECACHE_H
+#define PART_SHAPEFILECACHE_H
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <fastsignals/signal.h>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace App
+{
+class Document;
+}
+
+namespace Part
+{
+
+/** A bounded cache of the shapes stored in document files
+ *
+ * Restoring a PropertyPartShape parses its BRep or binary shape file into
+ * new OCC structures every time, even if the same document file was saved
+ * or opened shortly before, e.g. when reverting a document or reopening it
+ * after saving. This cache remembers the shape of each shape file in a
+ * document file, so that those shapes are shared instead of parsed again,
+ * including their geometry and triangulation.
+ *
+ * An entry is identified by the canonical path of the document file and the
+ * name of the shape file in it, and is only used as long as the size and the
+ * modification time of the document file are unchanged. So looking up a
+ * shape costs a file status query, and nothing is read or hashed on a miss.
+ *
+ * The cached shapes are shared between all their users as any other shape
+ * assigned to several properties, i.e. they are expected not to be modified
+ * in place. The entries outlive their document, so that reopening it hits
+ * the cache, and are bounded by the memory held by their shapes. That memory
+ * is estimated by the uncompressed size of the shape files, as listed in the
+ * directory of the document file, instead of walking the shapes.
+ */
+class PartExport ShapeFileCache
+{
+public:
+    static ShapeFileCache& instance();
+
+    /// Check whether the cache is enabled, i.e. has a non zero memory budget
+    bool isEnabled() const;
+
+    /** Look up a shape
+     *
+     * @param archive: the path of the document file
+     * @param file: the name of the shape file in the document file
+     * @param shape: returns the shape
+     *
+     * @return Returns true if the shape is found and the document file is
+     * unchanged since the shape was stored
+     */
+    bool find(const std::string& archive, const std::string& file, TopoDS_Shape& shape);
+
+    /// Store the shape read from a shape file of a document file
+    void store(const std::string& archive, const std::string& file, const TopoDS_Shape& shape);
+
+    /** Store the shape written to a shape file while saving a document
+     *
+     * The shape is stored once the document file is complete, see
+     * App::Document::signalFinishSave. Nothing is stored if the document is
+     * written without saving it to its file, e.g. by the autosaver.
+     */
+    void storeOnSave(const App::Document* doc, const std::string& file, const TopoDS_Shape& shape);
+
+    /// Remove all entries
+    void clear();
+
+    /// Set the memory budget in bytes, zero disables the cache
+    void setBudget(std::size_t bytes);
+
+    /// Return the memory budget in bytes
+    std::size_t getBudget() const;
+
+    struct Statistics
+    {
+        /// Number of shapes taken from the cache
+        std::size_t hits = 0;
+        /// Number of shapes not found in the cache
+        std::size_t misses = 0;
+    };
+    Statistics getStatistics() const;
+
+private:
+    ShapeFileCache();
+    void evict();
+
+    /// Size and modification time of a document file
+    using Stamp = std::pair<std::uintmax_t, std::int64_t>;
+    static bool getStamp(const std::string& archive, std::string& path, Stamp& stamp);
+    bool getFileSize(
+        const std::string& path,
+        const Stamp& stamp,
+        const std::string& file,
+        std::size_t& size
+    );
+
+    struct Entry
+    {
+        std::string key;
+        Stamp stamp;
+        TopoDS_Shape shape;
+        std::size_t size;
+    };
+    std::list<Entry> entries;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    /// Documents being saved and the shapes written by them
+    std::unordered_map<const App::Document*, std::map<std::string, TopoDS_Shape>> pending;
+    /// Uncompressed size of the files in the last document file looked up
+    struct Directory
+    {
+        std::string path;
+        Stamp stamp;
+        std::unordered_map<std::string, std::size_t> sizes;
+    };
+    Directory directory;
+    std::size_t budget;
+    std::size_t used {0};
+    Statistics statistics;
+    mutable std::mutex mutex;
+    fastsignals::scoped_connection connStartSave;
+    fastsignals::scoped_connection connFinishSave;
+    fastsignals::scoped_connection connDeleteDocument;
+};
+
+}  // namespace Part
+
+#endif  // PART_SHAPEFILECACHE_H
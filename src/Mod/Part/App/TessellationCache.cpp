@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <App/Application.h>
+#include <Base/Console.h>
+#include <Base/Parameter.h>
+
+#include "TessellationCache.h"
+#include "TopoShape.h"
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+namespace
+{
+
+std::size_t getMemSize(const Handle(Poly_Triangulation) & triangulation)
+{
+    std::size_t nodes = triangulation->NbNodes();
+    std::size_t size = sizeof(Poly_Triangulation) + nodes * sizeof(gp_Pnt)
+        + triangulation->NbTriangles() * sizeof(Poly_Triangle);
+    if (triangulation->HasUVNodes()) {
+        size += nodes * sizeof(gp_Pnt2d);
+    }
+    return size;
+}
+
+}  // namespace
+
+std::size_t TessellationCache::KeyHasher::operator()(const Key& key) const
+{
+    std::size_t seed = std::hash<const void*> {}(key.shape);
+    auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(std::hash<double> {}(key.deflection));
+    combine(std::hash<double> {}(key.angularDeflection));
+    combine(std::hash<bool> {}(key.relative));
+    return seed;
+}
+
+TessellationCache::TessellationCache()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    // in MB
+    budget = static_cast<std::size_t>(std::max(0L, hGrp->GetInt("TessellationCacheSize", 128)))
+        << 20;
+}
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+bool TessellationCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget > 0;
+}
+
+int TessellationCache::mesh(
+    const TopoDS_Shape& shape,
+    double deflection,
+    double angularDeflection,
+    bool relative
+)
+{
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    // Edges without a face get a 3D polygon instead of a triangulation
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+
+    // The faces and edges of the shape, which BRepMesh changes without
+    // holding the lock, so they must not be meshed by two threads at once
+    std::vector<const void*> tshapes;
+    tshapes.reserve(faceMap.Extent() + edgeFaces.Extent());
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+        tshapes.push_back(faceMap(i).TShape().get());
+    }
+    for (int i = 1; i <= edgeFaces.Extent(); ++i) {
+        tshapes.push_back(edgeFaces.FindKey(i).TShape().get());
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    std::vector<TopoDS_Shape> shapes;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        meshed.wait(lock, [&]() {
+            return std::ranges::none_of(tshapes, [this](const void* tshape) {
+                return meshing.contains(tshape);
+            });
+        });
+        // The same face or edge may appear with different locations
+        std::unordered_set<const void*> seen;
+        auto lookup = [&](const TopoDS_Shape& s) {
+            Key key {s.TShape().get(), deflection, angularDeflection, relative};
+            if (!seen.insert(key.shape).second) {
+                return true;
+            }
+            auto it = index.find(key);
+            if (it != index.end() && restore(s, *it->second)) {
+                entries.splice(entries.begin(), entries, it->second);
+                ++statistics.hits;
+                return true;
+            }
+            return false;
+        };
+        for (int i = 1; i <= faceMap.Extent(); ++i) {
+            const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+            if (lookup(face)) {
+                continue;
+            }
+            // Only drop the triangulation of the face itself. The discretization
+            // of its edges is kept, so that BRepMesh reuses it and the new
+            // triangulation stays conforming with the cached neighbour faces.
+            builder.UpdateFace(face, Handle(Poly_Triangulation)());
+            builder.Add(comp, face);
+            shapes.push_back(face);
+        }
+        for (int i = 1; i <= edgeFaces.Extent(); ++i) {
+            const TopoDS_Edge& edge = TopoDS::Edge(edgeFaces.FindKey(i));
+            if (!edgeFaces(i).IsEmpty() || BRep_Tool::Degenerated(edge) || lookup(edge)) {
+                continue;
+            }
+            // BRepMesh keeps an existing polygon regardless of its deflection
+            builder.UpdateEdge(edge, Handle(Poly_Polygon3D)());
+            builder.Add(comp, edge);
+            shapes.push_back(edge);
+        }
+        if (shapes.empty()) {
+            return 0;
+        }
+        statistics.misses += shapes.size();
+        meshing.insert(tshapes.begin(), tshapes.end());
+    }
+    auto release = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto tshape : tshapes) {
+                meshing.erase(tshape);
+            }
+        }
+        meshed.notify_all();
+    };
+
+    // Mesh without holding the lock, so that shapes not sharing any face or
+    // edge, e.g. of different views, can be meshed at the same time
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = relative ? Standard_True : Standard_False;
+    meshParams.Angle = angularDeflection;
+    meshParams.InParallel = Standard_True;
+    meshParams.AllowQualityDecrease = Standard_True;
+    std::vector<Entry> newEntries;
+    try {
+        BRepMesh_IncrementalMesh(comp, meshParams);
+        newEntries.reserve(shapes.size());
+        for (const auto& s : shapes) {
+            Entry entry {
+                {s.TShape().get(), deflection, angularDeflection, relative},
+                s,
+                {},
+                {},
+                {},
+                0
+            };
+            if (s.ShapeType() == TopAbs_FACE) {
+                TopLoc_Location loc;
+                entry.triangulation = BRep_Tool::Triangulation(TopoDS::Face(s), loc);
+                if (entry.triangulation.IsNull()) {
+                    continue;
+                }
+                entry.size = getMemSize(entry.triangulation);
+            }
+            else {
+                entry.polygon = BRep_Tool::Polygon3D(TopoDS::Edge(s), entry.location);
+                if (entry.polygon.IsNull()) {
+                    continue;
+                }
+                entry.size = sizeof(Poly_Polygon3D) + entry.polygon->NbNodes() * sizeof(gp_Pnt);
+            }
+            // The entry keeps the face or edge alive including its geometry
+            entry.size += TopoShape(s).getMemSize();
+            newEntries.push_back(std::move(entry));
+        }
+    }
+    catch (...) {
+        release();
+        throw;
+    }
+    release();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (budget == 0) {
+        return static_cast<int>(shapes.size());
+    }
+    for (auto& entry : newEntries) {
+        auto it = index.find(entry.key);
+        if (it != index.end()) {
+            used -= it->second->size;
+            entries.erase(it->second);
+            index.erase(it);
+        }
+        used += entry.size;
+        entries.push_front(std::move(entry));
+        index.emplace(entries.front().key, entries.begin());
+    }
+    evict();
+    FC_LOG("Meshed " << shapes.size() << " faces and free edges");
+    return static_cast<int>(shapes.size());
+}
+
+bool TessellationCache::restore(const TopoDS_Shape& shape, const Entry& entry) const
+{
+    BRep_Builder builder;
+    if (!entry.polygon.IsNull()) {
+        // The polygon is stored relative to the edge of the entry, which
+        // shares its TopoDS_TEdge with the given edge
+        TopLoc_Location loc;
+        const TopoDS_Edge& edge = TopoDS::Edge(entry.shape);
+        if (BRep_Tool::Polygon3D(edge, loc) != entry.polygon) {
+            builder.UpdateEdge(edge, entry.polygon, entry.location);
+        }
+        return true;
+    }
+
+    const TopoDS_Face& face = TopoDS::Face(shape);
+    const Handle(Poly_Triangulation)& triangulation = entry.triangulation;
+    TopLoc_Location loc;
+    Handle(Poly_Triangulation) current = BRep_Tool::Triangulation(face, loc);
+
+    // The edge polygons of the cached triangulation are gone if another
+    // consumer cleaned the shape in the meantime
+    for (TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+        if (!BRep_Tool::Degenerated(edge)
+            && BRep_Tool::PolygonOnTriangulation(edge, triangulation, loc).IsNull()) {
+            return false;
+        }
+    }
+    if (current != triangulation) {
+        builder.UpdateFace(face, triangulation);
+    }
+    return true;
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    used = 0;
+}
+
+void TessellationCache::setBudget(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    budget = bytes;
+    evict();
+}
+
+std::size_t TessellationCache::getBudget() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget;
+}
+
+TessellationCache::Statistics TessellationCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+void TessellationCache::evict()
+{
+    while (used > budget && !entries.empty()) {
+        used -= entries.back().size;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef PART_TESSELLATIONCACHE_H
+#define PART_TESSELLATIONCACHE_H
+
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+/** A bounded cache of face triangulations shared by all consumers of a mesh
+ *
+ * OCC stores the triangulation of a face in its underlying TopoDS_TFace, so
+ * every consumer that needs a different deflection, or cleans the shape
+ * before meshing, throws away the work of the others. This cache remembers
+ * the triangulation computed for each face and mesh parameters. When a shape
+ * is meshed again, e.g. for the 3D view after a feature edit, the faces that
+ * are shared with a shape meshed before get their triangulation restored and
+ * only the remaining faces are passed to BRepMesh. Free edges, i.e. edges
+ * not bounding any face, are handled the same way with their 3D polygon.
+ *
+ * Faces and edges are identified by their TopoDS_TShape. The cache holds on
+ * to the shapes of its entries, so that their identity cannot be reused by
+ * another shape while the entry lives. The memory of an entry therefore
+ * counts the face or edge with its geometry besides its mesh. Shapes are
+ * meshed without holding the cache lock, so shapes not sharing any face or
+ * edge can be meshed at the same time. A shape sharing any of them with a
+ * shape being meshed waits for it to finish.
+ */
+class PartExport TessellationCache
+{
+public:
+    static TessellationCache& instance();
+
+    /// Check whether the cache is enabled, i.e. has a non zero memory budget
+    bool isEnabled() const;
+
+    /** Triangulate all faces and discretize all free edges of a shape
+     *
+     * @param shape: the shape to mesh
+     * @param deflection: linear deflection
+     * @param angularDeflection: angular deflection in radians
+     * @param relative: whether the linear deflection is relative to the
+     * size of the edges
+     *
+     * @return Returns the number of faces and free edges that had to be meshed
+     */
+    int mesh(
+        const TopoDS_Shape& shape,
+        double deflection,
+        double angularDeflection,
+        bool relative = false
+    );
+
+    /// Remove all entries
+    void clear();
+
+    /// Set the memory budget in bytes, zero disables the cache
+    void setBudget(std::size_t bytes);
+    /// Return the memory budget in bytes
+    std::size_t getBudget() const;
+
+    struct Statistics
+    {
+        /// Number of faces and free edges whose mesh was taken from the cache
+        std::size_t hits = 0;
+        /// Number of faces and free edges that were meshed
+        std::size_t misses = 0;
+    };
+    Statistics getStatistics() const;
+
+private:
+    TessellationCache();
+    void evict();
+
+    struct Key
+    {
+        const void* shape;
+        double deflection;
+        double angularDeflection;
+        bool relative;
+
+        bool operator==(const Key& other) const = default;
+    };
+    struct KeyHasher
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+    struct Entry
+    {
+        Key key;
+        TopoDS_Shape shape;
+        /// Triangulation of a face
+        Handle(Poly_Triangulation) triangulation;
+        /// 3D polygon of a free edge and its location relative to the edge
+        Handle(Poly_Polygon3D) polygon;
+        TopLoc_Location location;
+        std::size_t size;
+    };
+    bool restore(const TopoDS_Shape& shape, const Entry& entry) const;
+    std::list<Entry> entries;  // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHasher> index;
+    std::size_t budget;
+    std::size_t used {0};
+    Statistics statistics;
+    /// Faces and edges of the shapes being meshed
+    std::unordered_set<const void*> meshing;
+    std::condition_variable meshed;
+    mutable std::mutex mutex;
+};
+
+}  // namespace Part
+
+#endif  // PART_TESSELLATIONCACHE_H
@@ -65,7 +65,6 @@
 #include <BRepLib.hxx>
 #include <BRepLib_FindSurface.hxx>
 #include <BRepLProp_SLProps.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepOffsetAPI_MakeOffset.hxx>
 #include <BRepOffsetAPI_MakeOffsetShape.hxx>
 #include <BRepOffsetAPI_MakePipe.hxx>
@@ -180,6 +179,7 @@
 #include "Interface.h"
 #include "modelRefine.h"
 #include "PartPyCXX.h"
+#include "TessellationCache.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapeCompSolidPy.h"
@@ -998,14 +998,8 @@ void TopoShape::dump(std::ostream& out) const
 void TopoShape::exportStl(const char* filename, double deflection) const
 {
     StlAPI_Writer writer;
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        deflection,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(deflection),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance()
+        .mesh(this->_Shape, deflection, defaultAngularDeflection(deflection));
     writer.Write(this->_Shape, encodeFilename(filename).c_str());
 }
 
@@ -1027,14 +1021,7 @@ void TopoShape::exportFaceSet(
     bool supportFaceColors = (numFaces == colors.size());
 
     std::size_t index = 0;
-    BRepMesh_IncrementalMesh MESH(
-        this->_Shape,
-        dev,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(dev),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance().mesh(this->_Shape, dev, defaultAngularDeflection(dev));
     for (ex.Init(this->_Shape, TopAbs_FACE); ex.More(); ex.Next(), index++) {
         // get the shape and mesh it
         const TopoDS_Face& aFace = TopoDS::Face(ex.Current());
@@ -3655,14 +3642,7 @@ void TopoShape::
     }
 
     // get the meshes of all faces and then merge them
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        accuracy,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(accuracy),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance().mesh(this->_Shape, accuracy, defaultAngularDeflection(accuracy));
     std::vector<Domain> domains;
     getDomains(domains);
     getFacesFromDomains(domains, aPoints, aTopo);
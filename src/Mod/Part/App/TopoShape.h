@@ -46,9 +46,11 @@
 #include <BRepTools_ReShape.hxx>
 #include <ShapeFix_Root.hxx>
 
+class Bnd_Box;
 class gp_Ax1;
 class gp_Ax2;
 class gp_Pln;
+class gp_Pnt;
 class gp_Vec;
 
 namespace Base
@@ -1677,6 +1679,28 @@ public:
     ) const;
     //@}
 
+    /** @name Bounding box queries
+     *
+     * The queries use a bounding box index of the sub shapes of the given
+     * type, which is built on first use and kept until the shape changes.
+     * They return the indices of the candidate sub shapes in ascending
+     * order. The bounding boxes include the shape tolerances, so the
+     * candidates are a superset of the actual matches, and the caller is
+     * expected to check them further.
+     */
+    //@{
+    /// Find sub shapes whose bounding box is within the given distance of a point
+    std::vector<int> findSubShapesNearPoint(
+        TopAbs_ShapeEnum type,
+        const gp_Pnt& pnt,
+        double tol = 1e-7
+    ) const;
+    /// Find sub shapes whose bounding box intersects the given box
+    std::vector<int> findSubShapesInBox(TopAbs_ShapeEnum type, const Bnd_Box& box) const;
+    /// Find sub shapes whose bounding box intersects the given plane
+    std::vector<int> findSubShapesNearPlane(TopAbs_ShapeEnum type, const gp_Pln& pln) const;
+    //@}
+
     void copyElementMap(const TopoShape& topoShape, const char* op = nullptr);
     bool canMapElement(const TopoShape& other) const;
     void cacheRelatedElements(
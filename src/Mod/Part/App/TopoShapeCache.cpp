@@ -22,6 +22,12 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <algorithm>
+
+#include <Bnd_HArray1OfBox.hxx>
+#include <BRepBndLib.hxx>
+#include <TColStd_ListIteratorOfListOfInteger.hxx>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
@@ -116,6 +122,63 @@ std::vector<TopoShape> TopoShapeCache::Ancestry::getTopoShapes(const TopoShape&
     return res;
 }
 
+TopoShapeCache::SpatialIndex& TopoShapeCache::Ancestry::getSpatialIndex()
+{
+    if (!spatialIndex) {
+        spatialIndex = std::make_shared<SpatialIndex>(shapes);
+    }
+    return *spatialIndex;
+}
+
+TopoShapeCache::SpatialIndex::SpatialIndex(const TopTools_IndexedMapOfShape& shapes)
+{
+    std::vector<Bnd_Box> boxes;
+    for (int i = 1; i <= shapes.Extent(); ++i) {
+        Bnd_Box box;
+        BRepBndLib::Add(shapes(i), box, Standard_False);
+        if (box.IsVoid() || box.IsOpen()) {
+            unbounded.push_back(i);
+            continue;
+        }
+        boxes.push_back(box);
+        indices.push_back(i);
+    }
+    if (boxes.empty()) {
+        return;
+    }
+    Handle(Bnd_HArray1OfBox) array = new Bnd_HArray1OfBox(1, static_cast<int>(boxes.size()));
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        array->SetValue(static_cast<int>(i) + 1, boxes[i]);
+    }
+    sorter.Initialize(array);
+}
+
+std::vector<int> TopoShapeCache::SpatialIndex::find(const Bnd_Box& box)
+{
+    if (indices.empty() || box.IsVoid()) {
+        return unbounded;
+    }
+    return collect(sorter.Compare(box));
+}
+
+std::vector<int> TopoShapeCache::SpatialIndex::find(const gp_Pln& pln)
+{
+    if (indices.empty()) {
+        return unbounded;
+    }
+    return collect(sorter.Compare(pln));
+}
+
+std::vector<int> TopoShapeCache::SpatialIndex::collect(const TColStd_ListOfInteger& found) const
+{
+    std::vector<int> res(unbounded);
+    for (TColStd_ListIteratorOfListOfInteger it(found); it.More(); it.Next()) {
+        res.push_back(indices[it.Value() - 1]);
+    }
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
 TopoDS_Shape TopoShapeCache::Ancestry::stripLocation(const TopoDS_Shape& parent, const TopoDS_Shape& child)
 {
     if (parent.Location() != owner->location) {
@@ -25,6 +25,9 @@
 #ifndef FREECAD_TOPOSHAPECACHE_H
 #define FREECAD_TOPOSHAPECACHE_H
 
+#include <Bnd_BoundSortBox.hxx>
+#include <Bnd_Box.hxx>
+#include <gp_Pln.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
@@ -33,6 +36,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <memory>
 #include <utility>
 
 #include <App/ElementMap.h>
@@ -82,6 +86,29 @@ public:
         TopTools_IndexedDataMapOfShapeListOfShape shapes;
     };
 
+    /// Bounding box index over the sub-shapes of one type
+    class PartExport SpatialIndex
+    {
+    public:
+        explicit SpatialIndex(const TopTools_IndexedMapOfShape& shapes);
+
+        /// Return the indices of the shapes whose bounding box intersects the given box, in
+        /// ascending order
+        std::vector<int> find(const Bnd_Box& box);
+        /// Return the indices of the shapes whose bounding box intersects the given plane, in
+        /// ascending order
+        std::vector<int> find(const gp_Pln& pln);
+
+    private:
+        std::vector<int> collect(const TColStd_ListOfInteger& found) const;
+
+        Bnd_BoundSortBox sorter;
+        /// Shape index of each box in the sorter
+        std::vector<int> indices;
+        /// Shapes without a finite bounding box, which match any query
+        std::vector<int> unbounded;
+    };
+
     /// Class for caching the ancestor and children shapes mapping
     class PartExport Ancestry
     {
@@ -101,6 +128,9 @@ public:
         /// faces containing a given edge.
         std::array<AncestorInfo, TopAbs_SHAPE + 1> ancestors;
 
+        /// Only depends on the geometry, and is therefore kept by clear()
+        std::shared_ptr<SpatialIndex> spatialIndex;
+
         TopoShape _getTopoShape(const TopoShape& parent, int index);
 
     public:
@@ -112,6 +142,9 @@ public:
         TopoDS_Shape find(const TopoDS_Shape& parent, int index);
         int count() const;
         bool empty() const;
+        /// Return the bounding box index of the shapes, built on first use. The boxes are in the
+        /// coordinates of the cached shape, i.e. without the location of the owner TopoShape.
+        SpatialIndex& getSpatialIndex();
 
         friend TopoShapeCache;
     };
@@ -23,7 +23,9 @@
  ***************************************************************************/
 
 #include <cmath>
+#include <exception>
 #include <limits>
+#include <numeric>
 
 #ifndef _Standard_Version_HeaderFile
 # include <Standard_Version.hxx>
@@ -31,6 +33,7 @@
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
+#include <BRepBndLib.hxx>
 #if OCC_VERSION_HEX < 0x070600
 # include <BRepAdaptor_HCurve.hxx>
 # include <BRepAdaptor_HCompCurve.hxx>
@@ -101,8 +104,10 @@
 #include "Base/Tools.h"
 #include "OCCTProgressIndicator.h"
 
+#include <App/Application.h>
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
+#include <App/RecomputeProfiler.h>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <BRepFeat_MakeRevol.hxx>
 
@@ -320,6 +325,45 @@ TopoDS_Shape TopoShape::findShape(TopAbs_ShapeEnum type, int idx) const
     return _cache->findShape(_Shape, type, idx);
 }
 
+std::vector<int> TopoShape::findSubShapesNearPoint(
+    TopAbs_ShapeEnum type,
+    const gp_Pnt& pnt,
+    double tol
+) const
+{
+    Bnd_Box box;
+    box.Set(pnt);
+    box.Enlarge(tol);
+    return findSubShapesInBox(type, box);
+}
+
+std::vector<int> TopoShape::findSubShapesInBox(TopAbs_ShapeEnum type, const Bnd_Box& box) const
+{
+    if (isNull()) {
+        return {};
+    }
+    initCache();
+    auto& index = _cache->getAncestry(type).getSpatialIndex();
+    // The index is built on the shape without its location
+    if (_Shape.Location().IsIdentity()) {
+        return index.find(box);
+    }
+    return index.find(box.Transformed(_Shape.Location().Inverted().Transformation()));
+}
+
+std::vector<int> TopoShape::findSubShapesNearPlane(TopAbs_ShapeEnum type, const gp_Pln& pln) const
+{
+    if (isNull()) {
+        return {};
+    }
+    initCache();
+    auto& index = _cache->getAncestry(type).getSpatialIndex();
+    if (_Shape.Location().IsIdentity()) {
+        return index.find(pln);
+    }
+    return index.find(pln.Transformed(_Shape.Location().Inverted().Transformation()));
+}
+
 std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(
     const TopoShape& subshape,
     std::vector<std::string>* names,
@@ -335,7 +379,6 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(
         return res;
     }
     double tol2 = tol * tol;
-    int index = 0;
     TopAbs_ShapeEnum shapeType = subshape.shapeType();
 
     // This is an intentionally recursive method, which will exit after looking through all
@@ -443,16 +486,16 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(
                 }
             }
             break;
-        case TopAbs_VERTEX:
+        case TopAbs_VERTEX: {
             // Vertex search will do comparison with tolerance to account for
-            // rounding error inccured through transformation.
-            for (auto& shape : getSubTopoShapes(TopAbs_VERTEX)) {
-                ++index;
-                if (BRep_Tool::Pnt(TopoDS::Vertex(shape.getShape()))
-                        .SquareDistance(BRep_Tool::Pnt(TopoDS::Vertex(subshape.getShape())))
-                    <= tol2) {
+            // rounding error inccured through transformation. Only the
+            // vertices whose bounding box is near the point are checked.
+            gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(subshape.getShape()));
+            for (int idx : findSubShapesNearPoint(TopAbs_VERTEX, pnt, tol)) {
+                auto shape = getSubTopoShape(TopAbs_VERTEX, idx);
+                if (BRep_Tool::Pnt(TopoDS::Vertex(shape.getShape())).SquareDistance(pnt) <= tol2) {
                     if (names) {
-                        names->push_back(std::string("Vertex") + std::to_string(index));
+                        names->push_back(std::string("Vertex") + std::to_string(idx));
                     }
                     res.push_back(shape);
                     if (singleSearch) {
@@ -461,6 +504,7 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(
                 }
             }
             break;
+        }
         case TopAbs_EDGE:
         case TopAbs_FACE: {
             std::unique_ptr<Geometry> geom;
@@ -1399,6 +1443,210 @@ void checkForParallelOrCoplanar(
     }
 }
 
+// Whether large element maps may collect their names on several threads
+bool isParallelElementMap()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("ParallelElementMap", true);
+}
+
+/// A name collected for an element of the new shape
+struct NameEntry
+{
+    Data::IndexedName element;
+    NameKey key;
+    NameInfo info;
+};
+
+/// The history of an element of an input shape as reported by the mapper
+struct ElementHistory
+{
+    ShapeInfo* info;
+    const TopoShape* shape;
+    int index;
+    TopoDS_Shape element;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+};
+
+/// A batch of elements, possibly of several types and input shapes
+struct NameJob
+{
+    std::vector<ElementHistory> history;
+    std::vector<NameEntry> names;
+    std::exception_ptr error;
+};
+
+// Collect the names of the new elements modified or generated from the
+// elements of a job. This only reads the element maps and shape caches, and
+// may therefore run concurrently for different jobs. The mapper is not
+// queried here, because its result is a reference to a shared buffer.
+void collectNames(
+    const TopoShape& self,
+    NameJob& job,
+    const std::array<ShapeInfo*, TopAbs_SHAPE>& infoMap,
+    const char* op
+)
+{
+    for (auto& history : job.history) {
+        auto& info = *history.info;
+        const auto& incomingShape = *history.shape;
+        int i = history.index;
+        // Find all new objects that are a modification of the old object
+        Data::ElementIDRefs sids;
+        NameKey key(
+            info.type,
+            incomingShape
+                .getMappedName(Data::IndexedName::fromConst(info.shapetype, i), true, &sids)
+        );
+
+        int newShapeCounter = 0;
+        for (auto& newShape : history.modified) {
+            ++newShapeCounter;
+            if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                // NOLINTNEXTLINE
+                FC_ERR(
+                    "unknown modified shape type " << newShape.ShapeType() << " from "
+                                                   << info.shapetype << i
+                );
+                continue;
+            }
+            auto& newInfo = *infoMap.at(newShape.ShapeType());
+            if (newInfo.type != newShape.ShapeType()) {
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // TODO: it seems modified shape may report higher
+                    // level shape type just like generated shape below.
+                    // Maybe we shall do the same for name construction.
+                    // NOLINTNEXTLINE
+                    FC_WARN(
+                        "modified shape type " << TopoShape::shapeName(newShape.ShapeType())
+                                               << " mismatch with " << info.shapetype << i
+                    );
+                }
+                continue;
+            }
+            int newShapeIndex = newInfo.find(newShape);
+            if (newShapeIndex == 0) {
+                // This warning occurs in makeElementRevolve. It generates
+                // some shape from a vertex that never made into the
+                // final shape. There may be incomingShape cases there.
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // NOLINTNEXTLINE
+                    FC_WARN(
+                        "Cannot find " << op << " modified " << newInfo.shapetype << " from "
+                                       << info.shapetype << i
+                    );
+                }
+                continue;
+            }
+
+            Data::IndexedName element
+                = Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
+            if (self.getMappedName(element)) {
+                continue;
+            }
+
+            key.tag = incomingShape.Tag;
+            job.names.push_back({element, key, {newShapeCounter, sids, info.shapetype}});
+        }
+
+        int checkParallel = -1;
+        gp_Pln pln;
+
+        // Find all new objects that were generated from an old object
+        // (e.g. a face generated from an edge)
+        newShapeCounter = 0;
+        for (auto& newShape : history.generated) {
+            if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                // NOLINTNEXTLINE
+                FC_ERR(
+                    "unknown generated shape type " << newShape.ShapeType() << " from "
+                                                    << info.shapetype << i
+                );
+                continue;
+            }
+
+            int parallelFace = -1;
+            int coplanarFace = -1;
+            auto& newInfo = *infoMap.at(newShape.ShapeType());
+            std::vector<TopoDS_Shape> newShapes;
+            int shapeOffset = 0;
+            if (newInfo.type == newShape.ShapeType()) {
+                newShapes.push_back(newShape);
+            }
+            else {
+                // It is possible for the maker to report generating a
+                // higher level shape, such as shell or solid. For
+                // example, when extruding, OCC will report the
+                // extruding face generating the entire solid. However,
+                // it will also report the edges of the extruding face
+                // generating the side faces. In this case, too much
+                // information is bad for us. We don't want the name of
+                // the side face (and its edges) to be coupled with
+                // incomingShape (unrelated) edges in the extruding face.
+                //
+                // shapeOffset below is used to make sure the higher
+                // level mapped names comes late after sorting. We'll
+                // ignore those names if there are more precise mapping
+                // available.
+                shapeOffset = 3;
+
+                if (info.type == TopAbs_FACE && checkParallel < 0) {
+                    if (!TopoShape(history.element).findPlane(pln)) {
+                        checkParallel = 0;
+                    }
+                    else {
+                        checkParallel = 1;
+                    }
+                }
+                checkForParallelOrCoplanar(
+                    newShape,
+                    newInfo,
+                    newShapes,
+                    pln,
+                    parallelFace,
+                    coplanarFace,
+                    checkParallel
+                );
+            }
+            key.shapetype += shapeOffset;
+            for (auto& workingShape : newShapes) {
+                ++newShapeCounter;
+                int workingShapeIndex = newInfo.find(workingShape);
+                if (workingShapeIndex == 0) {
+                    if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                        // NOLINTNEXTLINE
+                        FC_WARN(
+                            "Cannot find " << op << " generated " << newInfo.shapetype << " from "
+                                           << info.shapetype << i
+                        );
+                    }
+                    continue;
+                }
+
+                Data::IndexedName element
+                    = Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
+                auto mapped = self.getMappedName(element);
+                if (mapped) {
+                    continue;
+                }
+
+                key.tag = incomingShape.Tag;
+                int index = -newShapeCounter;
+                if (newShapeCounter == parallelFace) {
+                    index = std::numeric_limits<int>::min();
+                }
+                else if (newShapeCounter == coplanarFace) {
+                    index = std::numeric_limits<int>::min() + 1;
+                }
+                job.names.push_back({element, key, {index, sids, info.shapetype}});
+            }
+            key.shapetype -= shapeOffset;
+        }
+    }
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(
     const TopoDS_Shape& shape,
@@ -1407,6 +1655,10 @@ TopoShape& TopoShape::makeShapeWithElementMap(
     const char* op
 )
 {
+    App::RecomputeProfiler::Scope profile(
+        "makeShapeWithElementMap",
+        App::RecomputeProfiler::Category::Other
+    );
     setShape(shape);
     if (shape.IsNull()) {
         FC_THROWM(NullShapeException, "Null shape");
@@ -1457,183 +1709,72 @@ TopoShape& TopoShape::makeShapeWithElementMap(
     std::string postfix;
     Data::MappedName newName;
 
-    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
-
     // First, collect names from other shapes that generates or modifies the
-    // new shape
+    // new shape. The mapper is queried up front, then the names are looked
+    // up in batches, on several threads for large shapes, and finally merged
+    // in the original order so that the resulting names are deterministic.
+    constexpr std::size_t jobSize = 256;
+    std::vector<NameJob> jobs;
+    std::size_t elementCount = 0;
     for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
         auto& info = *pinfo;
         for (const auto& incomingShape : shapes) {
             if (!canMapElement(incomingShape)) {
                 continue;
             }
+            // Flushing may reset the cache, so do it before taking the ancestry
+            incomingShape.flushElementMap();
             auto& otherMap = incomingShape._cache->getAncestry(info.type);
             if (otherMap.empty()) {
                 continue;
             }
             for (int i = 1; i <= otherMap.count(); i++) {
-                const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape
-                        .getMappedName(Data::IndexedName::fromConst(info.shapetype, i), true, &sids)
-                );
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR(
-                            "unknown modified shape type " << newShape.ShapeType() << " from "
-                                                           << info.shapetype << i
-                        );
-                        continue;
-                    }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN(
-                                "modified shape type " << shapeName(newShape.ShapeType())
-                                                       << " mismatch with " << info.shapetype << i
-                            );
-                        }
-                        continue;
-                    }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // NOLINTNEXTLINE
-                            FC_WARN(
-                                "Cannot find " << op << " modified " << newInfo.shapetype
-                                               << " from " << info.shapetype << i
-                            );
-                        }
-                        continue;
-                    }
-
-                    Data::IndexedName element
-                        = Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
-                        continue;
-                    }
-
-                    key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
+                if (jobs.empty() || jobs.back().history.size() >= jobSize) {
+                    jobs.emplace_back();
                 }
+                ElementHistory history {
+                    &info,
+                    &incomingShape,
+                    i,
+                    otherMap.find(incomingShape._Shape, i),
+                    {},
+                    {}
+                };
+                // Copy each result before the next query, as it may reuse the same buffer
+                history.modified = mapper.modified(history.element);
+                history.generated = mapper.generated(history.element);
+                jobs.back().history.push_back(std::move(history));
+                ++elementCount;
+            }
+        }
+    }
 
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR(
-                            "unknown generated shape type " << newShape.ShapeType() << " from "
-                                                            << info.shapetype << i
-                        );
-                        continue;
-                    }
-
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
-                    }
-                    else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(
-                            newShape,
-                            newInfo,
-                            newShapes,
-                            pln,
-                            parallelFace,
-                            coplanarFace,
-                            checkParallel
-                        );
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN(
-                                    "Cannot find " << op << " generated " << newInfo.shapetype
-                                                   << " from " << info.shapetype << i
-                                );
-                            }
-                            continue;
-                        }
-
-                        Data::IndexedName element
-                            = Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
+    flushElementMap();
+    auto runJob = [&](int index) {
+        auto& job = jobs[index];
+        try {
+            collectNames(*this, job, infoMap, op);
+        }
+        catch (...) {
+            job.error = std::current_exception();
+        }
+        job.history.clear();
+    };
+    // Looking up a sub-shape of a located shape in the cache is not thread safe
+    bool parallel = jobs.size() > 1 && elementCount >= 4 * jobSize
+        && _Shape.Location().IsIdentity() && isParallelElementMap();
+    OSD_Parallel::For(0, static_cast<int>(jobs.size()), runJob, !parallel);
 
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
-                    }
-                    key.shapetype -= shapeOffset;
-                }
-            }
+    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
+    for (auto& job : jobs) {
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+        for (auto& entry : job.names) {
+            newNames[entry.element][entry.key] = std::move(entry.info);
         }
     }
+    jobs.clear();
 
     // We shall first exclude those names generated from high level mapping. If
     // there are still any unnamed elements left after we go through the process
@@ -1982,6 +2123,9 @@ TopoShape& TopoShape::makeShapeWithElementMap(
         }
         delayed = true;
     }
+    if (auto map = elementMap(false)) {
+        map->finalize();
+    }
     return *this;
 }
 
@@ -4320,12 +4464,16 @@ TopoShape& TopoShape::makeElementShape(
 )
 {
     TopoDS_Shape shape;
-    // OCCT 7.3.x requires calling Solid() and not Shape() to function correctly
-    if (typeid(mkShape) == typeid(BRepPrimAPI_MakeHalfSpace)) {
-        shape = static_cast<BRepPrimAPI_MakeHalfSpace&>(mkShape).Solid();
-    }
-    else {
-        shape = mkShape.Shape();
+    {
+        // Shape() runs the algorithm if it is not done yet
+        App::RecomputeProfiler::Scope profile("Shape", App::RecomputeProfiler::Category::Kernel);
+        // OCCT 7.3.x requires calling Solid() and not Shape() to function correctly
+        if (typeid(mkShape) == typeid(BRepPrimAPI_MakeHalfSpace)) {
+            shape = static_cast<BRepPrimAPI_MakeHalfSpace&>(mkShape).Solid();
+        }
+        else {
+            shape = mkShape.Shape();
+        }
     }
     return makeShapeWithElementMap(shape, MapperMaker(mkShape), shapes, op);
 }
@@ -5815,6 +5963,10 @@ TopoShape& TopoShape::makeElementBoolean(
     double tolerance
 )
 {
+    App::RecomputeProfiler::Scope profile(
+        "makeElementBoolean",
+        App::RecomputeProfiler::Category::Other
+    );
     if (!maker) {
         FC_THROWM(Base::CADKernelError, "no maker");
     }
@@ -5999,11 +6151,14 @@ TopoShape& TopoShape::makeElementBoolean(
     else if (tolerance < 0.0) {
         FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
     }
+    {
+        App::RecomputeProfiler::Scope profileBuild(maker, App::RecomputeProfiler::Category::Kernel);
 #if OCC_VERSION_HEX >= 0x070600
-    mk->Build(OCCTProgressIndicator::getAppIndicator().Start());
+        mk->Build(OCCTProgressIndicator::getAppIndicator().Start());
 #else
-    mk->Build();
+        mk->Build();
 #endif
+    }
     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
         FC_THROWM(Base::CADKernelError, "User aborted");
     }
@@ -6105,9 +6260,19 @@ Data::MappedElement TopoShape::chooseMatchingSubShapeByPlaneOrLine(
     // See if we have a Face.  If so, try to match using a plane.
     auto targetShape = shapeToFind.getSubTopoShape("Face", true);
     if (!targetShape.isNull()) {
-        int index = 0;
-        for (const auto& searchFace : shapeToLookIn.getSubTopoShapes(TopAbs_FACE)) {
-            index++;  // We have to generate the element index.
+        // Coplanar faces must touch the plane of the target, so only check
+        // the faces whose bounding box intersects it.
+        std::vector<int> indices;
+        gp_Pln pln;
+        if (targetShape.findPlane(pln)) {
+            indices = shapeToLookIn.findSubShapesNearPlane(TopAbs_FACE, pln);
+        }
+        else {
+            indices.resize(shapeToLookIn.countSubShapes(TopAbs_FACE));
+            std::iota(indices.begin(), indices.end(), 1);
+        }
+        for (int index : indices) {
+            auto searchFace = shapeToLookIn.getSubTopoShape(TopAbs_FACE, index);
             if (targetShape.isCoplanar(searchFace)) {
                 if (!result.name.empty()) {
                     return {};  // Found more than one, invalidate our guess.  Future: return all
@@ -6121,9 +6286,10 @@ Data::MappedElement TopoShape::chooseMatchingSubShapeByPlaneOrLine(
     // later can improve.
     targetShape = shapeToFind.getSubTopoShape("Edge", true);
     if (!targetShape.isNull()) {  // Try to match edges
-        int index = 0;
-        for (const auto& searchEdge : shapeToLookIn.getSubTopoShapes(TopAbs_EDGE)) {
-            index++;
+        Bnd_Box box;
+        BRepBndLib::Add(targetShape.getShape(), box, Standard_False);
+        for (int index : shapeToLookIn.findSubShapesInBox(TopAbs_EDGE, box)) {
+            auto searchEdge = shapeToLookIn.getSubTopoShape(TopAbs_EDGE, index);
             if (targetShape.isSame(searchEdge)) {  // TODO: Test for edges that are collinear as
                                                    // really what we want
                 if (!result.name.empty()) {
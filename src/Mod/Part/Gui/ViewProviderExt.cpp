@@ -22,13 +22,13 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+
 #include <Bnd_Box.hxx>
 #include <BRep_Tool.hxx>
-#include <BRepTools.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <gp_Trsf.hxx>
 #include <Precision.hxx>
 #include <Poly_Array1OfTriangle.hxx>
@@ -84,6 +84,7 @@
 #include <Gui/Utilities.h>
 
 #include <Mod/Part/App/ShapeMapHasher.h>
+#include <Mod/Part/App/TessellationCache.h>
 #include <Mod/Part/App/Tools.h>
 
 #include "ViewProviderExt.h"
@@ -1049,9 +1050,20 @@ void ViewProviderPartExt::setupCoinGeometry(
     SoBrepPointSet* nodeset,
     double deviation,
     double angularDeflection,
-    bool normalsFromUV
+    bool normalsFromUV,
+    FaceRanges* ranges
 )
 {
+    // Take the ranges of the current content, they are only valid again once
+    // the new content is completely set up
+    FaceRanges previous;
+    if (ranges) {
+        std::swap(previous, *ranges);
+        if (previous.normalsFromUV != normalsFromUV) {
+            previous.faces.clear();
+        }
+    }
+
     if (Part::Tools::isShapeEmpty(shape)) {
         coords->point.setNum(0);
         norm->vector.setNum(0);
@@ -1086,24 +1098,10 @@ void ViewProviderPartExt::setupCoinGeometry(
     // https://forum.freecad.org/viewtopic.php?t=77521
     // deflection = std::min(deflection, 20.0);
 
-    // create or use the mesh on the data structure
+    // create or use the mesh on the data structure, only the faces and free
+    // edges not meshed before with the same parameters are tessellated
     Standard_Real AngDeflectionRads = Base::toRadians(angularDeflection);
-
-    IMeshTools_Parameters meshParams;
-    meshParams.Deflection = deflection;
-    meshParams.Relative = Standard_False;
-    meshParams.Angle = AngDeflectionRads;
-    meshParams.InParallel = Standard_True;
-    meshParams.AllowQualityDecrease = Standard_True;
-
-    // Clear triangulation and PCurves from geometry which can slow down the process
-#if OCC_VERSION_HEX < 0x070600
-    BRepTools::Clean(shape);
-#else
-    BRepTools::Clean(shape, Standard_True);
-#endif
-
-    BRepMesh_IncrementalMesh(shape, meshParams);
+    Part::TessellationCache::instance().mesh(shape, deflection, AngDeflectionRads);
 
     // We must reset the location here because the transformation data
     // are set in the placement property
@@ -1174,6 +1172,23 @@ void ViewProviderPartExt::setupCoinGeometry(
     TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
     numNodes += vertexMap.Extent();
 
+    // keep a copy of the current content for the unchanged faces
+    std::vector<SbVec3f> oldVerts, oldNorms;
+    std::vector<int32_t> oldIndex;
+    if (!previous.faces.empty()) {
+        oldVerts.assign(
+            coords->point.getValues(0),
+            coords->point.getValues(0) + coords->point.getNum()
+        );
+        oldNorms.assign(norm->vector.getValues(0), norm->vector.getValues(0) + norm->vector.getNum());
+        oldIndex.assign(
+            faceset->coordIndex.getValues(0),
+            faceset->coordIndex.getValues(0) + faceset->coordIndex.getNum()
+        );
+    }
+    FaceRanges current;
+    current.normalsFromUV = normalsFromUV;
+
     // create memory for the nodes and indexes
     coords->point.setNum(numNodes);
     norm->vector.setNum(numNorms);
@@ -1219,88 +1234,109 @@ void ViewProviderPartExt::setupCoinGeometry(
         // check orientation
         TopAbs_Orientation orient = actFace.Orientation();
 
-        // cycling through the poly mesh
 #if OCC_VERSION_HEX < 0x070600
         const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
         const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
-        TColgp_Array1OfDir Normals(Nodes.Lower(), Nodes.Upper());
-#else
-        int numNodes = mesh->NbNodes();
-        TColgp_Array1OfDir Normals(1, numNodes);
 #endif
-        if (normalsFromUV) {
-            Part::Tools::getPointNormals(actFace, mesh, Normals);
-        }
 
-        for (int g = 1; g <= nbTriInFace; g++) {
-            // Get the triangle
-            Standard_Integer N1, N2, N3;
+        auto cached = previous.faces.find(actFace);
+        if (cached != previous.faces.end() && cached->second.mesh == mesh) {
+            // the face is unchanged, copy its nodes, normals and triangles
+            const FaceRange& range = cached->second;
+            std::copy_n(oldVerts.begin() + range.nodeOffset, nbNodesInFace, verts + faceNodeOffset);
+            std::copy_n(oldNorms.begin() + range.nodeOffset, nbNodesInFace, norms + faceNodeOffset);
+            for (int g = 0; g < nbTriInFace; g++) {
+                const int32_t* src = &oldIndex[(range.triaOffset + g) * 4];
+                int32_t* dst = &index[(faceTriaOffset + g) * 4];
+                for (int k = 0; k < 3; k++) {
+                    dst[k] = src[k] - range.nodeOffset + faceNodeOffset;
+                }
+                dst[3] = SO_END_FACE_INDEX;
+            }
+        }
+        else {
+            // cycling through the poly mesh
 #if OCC_VERSION_HEX < 0x070600
-            Triangles(g).Get(N1, N2, N3);
+            TColgp_Array1OfDir Normals(Nodes.Lower(), Nodes.Upper());
 #else
-            mesh->Triangle(g).Get(N1, N2, N3);
+            int numNodes = mesh->NbNodes();
+            TColgp_Array1OfDir Normals(1, numNodes);
 #endif
-
-            // change orientation of the triangle if the face is reversed
-            if (orient != TopAbs_FORWARD) {
-                Standard_Integer tmp = N1;
-                N1 = N2;
-                N2 = tmp;
+            if (normalsFromUV) {
+                Part::Tools::getPointNormals(actFace, mesh, Normals);
             }
 
-            // get the 3 points of this triangle
+            for (int g = 1; g <= nbTriInFace; g++) {
+                // Get the triangle
+                Standard_Integer N1, N2, N3;
 #if OCC_VERSION_HEX < 0x070600
-            gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
+                Triangles(g).Get(N1, N2, N3);
 #else
-            gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
+                mesh->Triangle(g).Get(N1, N2, N3);
 #endif
 
-            // get the 3 normals of this triangle
-            gp_Vec NV1, NV2, NV3;
-            if (normalsFromUV) {
-                NV1.SetXYZ(Normals(N1).XYZ());
-                NV2.SetXYZ(Normals(N2).XYZ());
-                NV3.SetXYZ(Normals(N3).XYZ());
-            }
-            else {
-                gp_Vec v1 = Base::convertTo<gp_Vec>(V1);
-                gp_Vec v2 = Base::convertTo<gp_Vec>(V2);
-                gp_Vec v3 = Base::convertTo<gp_Vec>(V3);
-
-                gp_Vec normal = (v2 - v1) ^ (v3 - v1);
-                NV1 = normal;
-                NV2 = normal;
-                NV3 = normal;
-            }
+                // change orientation of the triangle if the face is reversed
+                if (orient != TopAbs_FORWARD) {
+                    Standard_Integer tmp = N1;
+                    N1 = N2;
+                    N2 = tmp;
+                }
+
+                // get the 3 points of this triangle
+#if OCC_VERSION_HEX < 0x070600
+                gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
+#else
+                gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
+#endif
 
-            // transform the vertices and normals to the place of the face
-            if (!identity) {
-                V1.Transform(myTransf);
-                V2.Transform(myTransf);
-                V3.Transform(myTransf);
+                // get the 3 normals of this triangle
+                gp_Vec NV1, NV2, NV3;
                 if (normalsFromUV) {
-                    NV1.Transform(myTransf);
-                    NV2.Transform(myTransf);
-                    NV3.Transform(myTransf);
+                    NV1.SetXYZ(Normals(N1).XYZ());
+                    NV2.SetXYZ(Normals(N2).XYZ());
+                    NV3.SetXYZ(Normals(N3).XYZ());
+                }
+                else {
+                    gp_Vec v1 = Base::convertTo<gp_Vec>(V1);
+                    gp_Vec v2 = Base::convertTo<gp_Vec>(V2);
+                    gp_Vec v3 = Base::convertTo<gp_Vec>(V3);
+
+                    gp_Vec normal = (v2 - v1) ^ (v3 - v1);
+                    NV1 = normal;
+                    NV2 = normal;
+                    NV3 = normal;
+                }
+
+                // transform the vertices and normals to the place of the face
+                if (!identity) {
+                    V1.Transform(myTransf);
+                    V2.Transform(myTransf);
+                    V3.Transform(myTransf);
+                    if (normalsFromUV) {
+                        NV1.Transform(myTransf);
+                        NV2.Transform(myTransf);
+                        NV3.Transform(myTransf);
+                    }
                 }
-            }
 
-            // add the normals for all points of this triangle
-            norms[faceNodeOffset + N1 - 1] += Base::convertTo<SbVec3f>(NV1);
-            norms[faceNodeOffset + N2 - 1] += Base::convertTo<SbVec3f>(NV2);
-            norms[faceNodeOffset + N3 - 1] += Base::convertTo<SbVec3f>(NV3);
-
-            // set the vertices
-            verts[faceNodeOffset + N1 - 1] = Base::convertTo<SbVec3f>(V1);
-            verts[faceNodeOffset + N2 - 1] = Base::convertTo<SbVec3f>(V2);
-            verts[faceNodeOffset + N3 - 1] = Base::convertTo<SbVec3f>(V3);
-
-            // set the index vector with the 3 point indexes and the end delimiter
-            index[faceTriaOffset * 4 + 4 * (g - 1)] = faceNodeOffset + N1 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 1] = faceNodeOffset + N2 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 2] = faceNodeOffset + N3 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 3] = SO_END_FACE_INDEX;
+                // add the normals for all points of this triangle
+                norms[faceNodeOffset + N1 - 1] += Base::convertTo<SbVec3f>(NV1);
+                norms[faceNodeOffset + N2 - 1] += Base::convertTo<SbVec3f>(NV2);
+                norms[faceNodeOffset + N3 - 1] += Base::convertTo<SbVec3f>(NV3);
+
+                // set the vertices
+                verts[faceNodeOffset + N1 - 1] = Base::convertTo<SbVec3f>(V1);
+                verts[faceNodeOffset + N2 - 1] = Base::convertTo<SbVec3f>(V2);
+                verts[faceNodeOffset + N3 - 1] = Base::convertTo<SbVec3f>(V3);
+
+                // set the index vector with the 3 point indexes and the end delimiter
+                index[faceTriaOffset * 4 + 4 * (g - 1)] = faceNodeOffset + N1 - 1;
+                index[faceTriaOffset * 4 + 4 * (g - 1) + 1] = faceNodeOffset + N2 - 1;
+                index[faceTriaOffset * 4 + 4 * (g - 1) + 2] = faceNodeOffset + N3 - 1;
+                index[faceTriaOffset * 4 + 4 * (g - 1) + 3] = SO_END_FACE_INDEX;
+            }
         }
+        current.faces[actFace] = FaceRange {mesh, faceNodeOffset, faceTriaOffset};
 
         parts[ii] = nbTriInFace;  // new part
 
@@ -1428,6 +1464,10 @@ void ViewProviderPartExt::setupCoinGeometry(
     faceset->partIndex.finishEditing();
     lineset->coordIndex.finishEditing();
 
+    if (ranges) {
+        *ranges = std::move(current);
+    }
+
 #ifdef FC_DEBUG
     Base::Console().log(
         "ViewProvider update time: %f s\n",
@@ -1498,7 +1538,8 @@ void ViewProviderPartExt::updateVisual()
             nodeset,
             Deviation.getValue(),
             AngularDeflection.getValue(),
-            NormalsFromUV
+            NormalsFromUV,
+            &lastRenderedFaces
         );
 
         lastRenderedShape = shape;
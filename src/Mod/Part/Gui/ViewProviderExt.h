@@ -29,12 +29,16 @@
 
 
 #include <map>
+#include <unordered_map>
+
+#include <Poly_Triangulation.hxx>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
 #include <Gui/ViewProviderTextureExtension.h>
 
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/ShapeMapHasher.h>
 #include <Mod/Part/PartGlobal.h>
 
 
@@ -183,7 +187,29 @@ public:
     /// Get the python wrapper for that ViewProvider
     PyObject* getPyObject() override;
 
-    /// configures Coin nodes so they render given toposhape
+    /// Location of the nodes and triangles of a face in the Coin nodes
+    struct FaceRange
+    {
+        Handle(Poly_Triangulation) mesh;
+        int nodeOffset = 0;
+        int triaOffset = 0;
+    };
+
+    /// Face ranges of the shape last set up in a group of Coin nodes
+    struct FaceRanges
+    {
+        bool normalsFromUV = false;
+        std::unordered_map<TopoDS_Shape, FaceRange, Part::ShapeMapHasher> faces;
+    };
+
+    /** configures Coin nodes so they render given toposhape
+     *
+     * If \a ranges is given, it must describe the current content of the
+     * Coin nodes. The nodes, normals and triangles of the faces that are
+     * unchanged, i.e. have the same underlying TopoDS_TFace, location,
+     * orientation and triangulation, are then copied over instead of being
+     * computed again. On return \a ranges describes the new content.
+     */
     static void setupCoinGeometry(
         TopoDS_Shape shape,
         SoCoordinate3* coords,
@@ -193,7 +219,8 @@ public:
         SoBrepPointSet* nodeset,
         double deviation,
         double angularDeflection,
-        bool normalsFromUV = false
+        bool normalsFromUV = false,
+        FaceRanges* ranges = nullptr
     );
 
     static void setupCoinGeometry(
@@ -257,6 +284,8 @@ private:
 
     // shape that was last rendered so if it does not change we don't re-render it without need
     TopoDS_Shape lastRenderedShape;
+    // faces of the last rendered shape, to only re-render the faces that changed
+    FaceRanges lastRenderedFaces;
 };
 
 }  // namespace PartGui
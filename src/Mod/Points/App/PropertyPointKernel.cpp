@@ -133,6 +133,22 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyPointKernel::canRestoreDocFileAsync() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointKernel::restoreDocFileAsync(Base::Reader& reader)
+{
+    auto kernel = std::make_shared<PointKernel>();
+    kernel->RestoreDocFile(reader);
+    return [this, kernel]() {
+        aboutToSetValue();
+        _cPoints->swap(kernel->getBasicPoints());
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
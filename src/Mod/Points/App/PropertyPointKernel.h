@@ -70,6 +70,10 @@ public:
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
     unsigned int getMemSize() const override;
+    bool isCopyOwningData() const override
+    {
+        return true;
+    }
     //@}
 
     /** @name Save/restore */
@@ -78,6 +82,8 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileAsync() const override;
+    std::function<void()> restoreDocFileAsync(Base::Reader& reader) override;
     //@}
 
     /** @name Modification */
@@ -5,10 +5,16 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
+#include "App/RecomputeProfiler.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
+#include <map>
+#include <sstream>
+#include <thread>
+
 using ::testing::Eq;
 using ::testing::Ne;
 
@@ -94,4 +100,297 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, parallelRecomputeExecutesEachObjectOnce)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    hGrp->SetBool("ParallelRecompute", true);
+    auto root = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Root"));
+    auto left = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Left"));
+    auto right = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Right"));
+    auto top = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Top"));
+    left->Source1.setValue(root);
+    right->Source1.setValue(root);
+    top->Source1.setValue(left);
+    top->Source2.setValue(right);
+
+    // Act
+    bool hasError = false;
+    int count = doc()->recompute({}, false, &hasError);
+    hGrp->SetBool("ParallelRecompute", parallel);
+
+    // Assert
+    EXPECT_FALSE(hasError);
+    EXPECT_EQ(count, 4);
+    for (auto obj : {root, left, right, top}) {
+        EXPECT_EQ(obj->ExecCount.getValue(), 1);
+        EXPECT_FALSE(obj->isTouched());
+    }
+}
+
+TEST_F(DocumentTest, parallelRecomputeRunsThreadSafeObjectsOnWorkers)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    long threads = hGrp->GetInt("RecomputeThreads", 0);
+    hGrp->SetBool("ParallelRecompute", true);
+    hGrp->SetInt("RecomputeThreads", 4);
+    auto add = [this](const char* name) {
+        return static_cast<App::FeatureTestThreadSafe*>(
+            doc()->addObject("App::FeatureTestThreadSafe", name));
+    };
+    auto root = add("Root");
+    auto left = add("Left");
+    auto right = add("Right");
+    auto top = add("Top");
+    left->Source1.setValue(root);
+    right->Source1.setValue(root);
+    top->Source1.setValue(left);
+    top->Source2.setValue(right);
+    int changes = 0;
+    fastsignals::scoped_connection conn = doc()->signalChangedObject.connect(
+        [&changes](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&prop == &static_cast<const App::FeatureTest&>(obj).ExecCount) {
+                ++changes;
+            }
+        });
+    std::ostringstream mainThread;
+    mainThread << std::this_thread::get_id();
+
+    // Act
+    bool hasError = false;
+    int count = doc()->recompute({}, false, &hasError);
+    hGrp->SetBool("ParallelRecompute", parallel);
+    hGrp->SetInt("RecomputeThreads", threads);
+
+    // Assert
+    EXPECT_FALSE(hasError);
+    EXPECT_EQ(count, 4);
+    EXPECT_EQ(changes, 4);  // Replayed on the main thread
+    for (auto obj : {root, left, right, top}) {
+        EXPECT_EQ(obj->ExecCount.getValue(), 1);
+        EXPECT_FALSE(obj->isTouched());
+        EXPECT_NE(obj->ExecThread.getStrValue(), mainThread.str());
+    }
+}
+
+TEST_F(DocumentTest, parallelRecomputeAbortWaitsForRunningObjects)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    long threads = hGrp->GetInt("RecomputeThreads", 0);
+    hGrp->SetBool("ParallelRecompute", true);
+    hGrp->SetInt("RecomputeThreads", 4);
+    std::vector<App::FeatureTestThreadSafe*> objects;
+    for (int i = 0; i < 8; ++i) {
+        objects.push_back(static_cast<App::FeatureTestThreadSafe*>(
+            doc()->addObject("App::FeatureTestThreadSafe", "Independent")));
+    }
+    objects[3]->ExceptionType.setValue(3);
+    std::map<const App::DocumentObject*, int> changes;
+    fastsignals::scoped_connection conn = doc()->signalChangedObject.connect(
+        [&changes](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&prop == &static_cast<const App::FeatureTest&>(obj).ExecCount) {
+                ++changes[&obj];
+            }
+        });
+
+    // Act
+    bool hasError = false;
+    doc()->recompute({}, false, &hasError);
+    hGrp->SetBool("ParallelRecompute", parallel);
+    hGrp->SetInt("RecomputeThreads", threads);
+
+    // Assert
+    EXPECT_TRUE(hasError);
+    EXPECT_EQ(objects[3]->ExecCount.getValue(), 0);
+    for (auto obj : objects) {
+        // Every object that ran had its notifications sent and its status updated
+        EXPECT_EQ(changes[obj], obj->ExecCount.getValue());
+        if (obj->ExecCount.getValue() != 0) {
+            EXPECT_FALSE(obj->isTouched());
+        }
+    }
+}
+
+TEST_F(DocumentTest, recomputeFollowsLinksAddedAgainstCreationOrder)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    auto third = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Third"));
+    doc()->recompute();
+    first->Source1.setValue(second);
+    second->Source1.setValue(third);
+    third->Integer.setValue(1);
+
+    // Act
+    bool hasError = false;
+    int count = doc()->recompute({first}, false, &hasError);
+
+    // Assert
+    EXPECT_FALSE(hasError);
+    EXPECT_EQ(count, 3);
+    for (auto obj : {first, second, third}) {
+        EXPECT_EQ(obj->ExecCount.getValue(), 2);
+        EXPECT_FALSE(obj->isTouched());
+    }
+}
+
+TEST_F(DocumentTest, batchScopeDefersNewObjectSignals)
+{
+    // Arrange
+    std::size_t announced = 0;
+    std::vector<App::DocumentObject*> batch;
+    int changes = 0;
+    fastsignals::scoped_connection newConn = doc()->signalNewObject.connect(
+        [&](const App::DocumentObject&) { ++announced; });
+    fastsignals::scoped_connection batchConn = doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objs) {
+            batch.insert(batch.end(), objs.begin(), objs.end());
+        });
+    fastsignals::scoped_connection changeConn = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property&) { ++changes; });
+
+    // Act
+    App::FeatureTest* first {};
+    App::FeatureTest* second {};
+    std::size_t inListInBatch = 0;
+    {
+        App::Document::BatchScope scope(doc());
+        first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+        second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+        auto removed = doc()->addObject("App::FeatureTest", "Removed");
+        second->Source1.setValue(first);
+        doc()->removeObject(removed->getNameInDocument());
+        inListInBatch = first->getInList().size();
+        EXPECT_TRUE(doc()->isBatching());
+    }
+
+    // Assert
+    EXPECT_FALSE(doc()->isBatching());
+    EXPECT_EQ(announced, 0);
+    EXPECT_EQ(changes, 0);
+    ASSERT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch[0], first);
+    EXPECT_EQ(batch[1], second);
+    EXPECT_EQ(inListInBatch, 0);
+    EXPECT_EQ(first->getInList(), std::vector<App::DocumentObject*> {second});
+    EXPECT_FALSE(first->testStatus(App::PendingNotify));
+    EXPECT_EQ(doc()->recompute(), 2);
+}
+
+TEST_F(DocumentTest, batchAnnouncesObjectsWithinTheirTransaction)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    std::vector<std::pair<const App::DocumentObject*, App::Transaction*>> appended;
+    std::size_t batchSize = 0;
+    fastsignals::scoped_connection appendConn = doc()->signalTransactionAppend.connect(
+        [&](const App::DocumentObject& obj, App::Transaction* transaction) {
+            appended.emplace_back(&obj, transaction);
+        });
+    fastsignals::scoped_connection batchConn = doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objs) { batchSize += objs.size(); });
+
+    // Act
+    App::DocumentObject* first {};
+    App::DocumentObject* second {};
+    std::size_t batchSizeOnCommit = 0;
+    {
+        App::Document::BatchScope scope(doc());
+        doc()->openTransaction("First");
+        first = doc()->addObject("App::FeatureTest", "First");
+        doc()->commitTransaction();
+        batchSizeOnCommit = batchSize;
+        doc()->openTransaction("Second");
+        second = doc()->addObject("App::FeatureTest", "Second");
+    }
+    doc()->commitTransaction();
+
+    // Assert
+    EXPECT_EQ(batchSizeOnCommit, 1);
+    EXPECT_EQ(batchSize, 2);
+    ASSERT_EQ(appended.size(), 2);
+    EXPECT_EQ(appended[0].first, first);
+    EXPECT_EQ(appended[1].first, second);
+    EXPECT_NE(appended[0].second, nullptr);
+    EXPECT_NE(appended[0].second, appended[1].second);
+}
+
+TEST_F(DocumentTest, coalesceScopeDeliversEachChangeOnce)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    std::size_t changeCount = 0;
+    std::vector<std::pair<const App::DocumentObject*, const App::Property*>> changes;
+    fastsignals::scoped_connection changeConn = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property&) { ++changeCount; });
+    fastsignals::scoped_connection coalescedConn = doc()->signalChangedObjects.connect(
+        [&](const auto& objs) { changes.insert(changes.end(), objs.begin(), objs.end()); });
+
+    // Act
+    std::size_t changesInScope = 0;
+    {
+        App::Document::CoalesceScope scope(doc());
+        for (long i = 0; i < 10; ++i) {
+            first->Integer.setValue(i);
+            second->Integer.setValue(i);
+        }
+        first->Float.setValue(1.0);
+        changesInScope = changes.size();
+    }
+
+    // Assert
+    EXPECT_EQ(changeCount, 21);
+    EXPECT_EQ(changesInScope, 0);
+    ASSERT_EQ(changes.size(), 3);
+    EXPECT_EQ(changes[0].first, first);
+    EXPECT_EQ(changes[0].second, &first->Integer);
+    EXPECT_EQ(changes[1].first, second);
+    EXPECT_EQ(changes[2].second, &first->Float);
+    EXPECT_EQ(first->Integer.getValue(), 9);
+}
+
+TEST_F(DocumentTest, recomputeProfilerRecordsEachFeature)
+{
+    // Arrange
+    auto& profiler = App::RecomputeProfiler::instance();
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    second->Source1.setValue(first);
+    profiler.clear();
+    profiler.setEnabled(true);
+
+    // Act
+    doc()->recompute();
+    profiler.setEnabled(false);
+    auto nodes = profiler.getNodes();
+    std::string json = profiler.dump();
+    std::string trace = profiler.dump(App::RecomputeProfiler::Format::ChromeTrace);
+    profiler.clear();
+
+    // Assert
+    ASSERT_EQ(nodes.size(), 1);
+    const auto& recompute = nodes.front();
+    EXPECT_EQ(recompute.category, App::RecomputeProfiler::Category::Document);
+    ASSERT_EQ(recompute.children.size(), 2);
+    EXPECT_EQ(recompute.children[0].object, first->getFullName());
+    EXPECT_EQ(recompute.children[1].object, second->getFullName());
+    for (const auto& child : recompute.children) {
+        EXPECT_EQ(child.category, App::RecomputeProfiler::Category::Feature);
+        EXPECT_LE(child.start + child.duration, recompute.start + recompute.duration + 1.0);
+    }
+    EXPECT_NE(json.find("\"objects\":[{\"object\":"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_TRUE(profiler.getNodes().empty());
+}
+
 // NOLINTEND(readability-magic-numbers)
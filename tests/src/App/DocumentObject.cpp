@@ -9,6 +9,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/GeoFeatureGroupExtension.h>
+#include <App/PropertyGeo.h>
 #include <Base/Interpreter.h>
 
 using namespace App;
@@ -155,4 +156,35 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, getCachedSubObject)
+{
+    // Arrange
+    auto outer {_doc->addObject("App::Part")};
+    auto inner {_doc->addObject("App::Part")};
+    outer->getExtensionByType<App::GeoFeatureGroupExtension>()->addObject(inner);
+    auto innerPlacement {freecad_cast<App::PropertyPlacement*>(inner->getPropertyByName("Placement"))};
+    innerPlacement->setValue(Base::Placement(Base::Vector3d(1, 2, 3), Base::Rotation()));
+    auto subName {std::string(inner->getNameInDocument()) + "."};
+
+    // Act
+    Base::Matrix4D expectedMat;
+    auto expected {outer->getSubObject(subName.c_str(), nullptr, &expectedMat)};
+    Base::Matrix4D firstMat;
+    auto first {outer->getCachedSubObject(subName.c_str(), &firstMat)};
+    Base::Matrix4D secondMat;
+    auto second {outer->getCachedSubObject(subName.c_str(), &secondMat)};
+    innerPlacement->setValue(Base::Placement(Base::Vector3d(4, 5, 6), Base::Rotation()));
+    Base::Matrix4D changedMat;
+    auto changed {outer->getCachedSubObject(subName.c_str(), &changedMat)};
+
+    // Assert
+    EXPECT_EQ(expected, inner);
+    EXPECT_EQ(first, inner);
+    EXPECT_EQ(second, inner);
+    EXPECT_EQ(changed, inner);
+    EXPECT_EQ(firstMat, expectedMat);
+    EXPECT_EQ(secondMat, expectedMat);
+    EXPECT_EQ(changedMat.getCol(3), Base::Vector3d(4, 5, 6));
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
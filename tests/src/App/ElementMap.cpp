@@ -325,6 +325,57 @@ TEST_F(ElementMapTest, findAll)
     EXPECT_EQ(findResult2[1].first, anotherMappedName2);
 }
 
+TEST_F(ElementMapTest, findAfterFinalize)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+
+    Data::IndexedName element("Edge", 1);
+    Data::MappedName mappedName("TEST");
+    Data::MappedName anotherMappedName("ANOTHERTEST");
+    elementMap.setElementName(element, mappedName, 0);
+    elementMap.setElementName(element, anotherMappedName, 0);
+
+    Data::IndexedName element2("Edge", 2);
+    Data::MappedName mappedName2("TEST2");
+    elementMap.setElementName(element2, mappedName2, 0);
+
+    // Act
+    elementMap.finalize();
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), 3);
+    EXPECT_EQ(elementMap.getAll().size(), 3);
+    EXPECT_EQ(elementMap.find(mappedName), element);
+    EXPECT_EQ(elementMap.find(anotherMappedName), element);
+    EXPECT_EQ(elementMap.find(mappedName2), element2);
+    EXPECT_EQ(elementMap.find(Data::MappedName("MISSING")), Data::IndexedName());
+    EXPECT_EQ(elementMap.find(element), mappedName);
+}
+
+TEST_F(ElementMapTest, modifyAfterFinalize)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+
+    Data::IndexedName element("Edge", 1);
+    Data::MappedName mappedName("TEST");
+    elementMap.setElementName(element, mappedName, 0);
+    elementMap.finalize();
+
+    Data::IndexedName element2("Edge", 2);
+    Data::MappedName mappedName2("TEST2");
+
+    // Act
+    elementMap.setElementName(element2, mappedName2, 0);
+    elementMap.erase(mappedName);
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), 1);
+    EXPECT_EQ(elementMap.find(mappedName), Data::IndexedName());
+    EXPECT_EQ(elementMap.find(mappedName2), element2);
+}
+
 TEST_F(ElementMapTest, mimicOnePart)
 {
     // Arrange
@@ -29,7 +29,9 @@
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
+#include "App/ExpressionProgram.h"
 #include "App/ExpressionTokenizer.h"
+#include "App/PropertyUnits.h"
 
 // +------------------------------------------------+
 // | Note: For more expression related tests, see:  |
@@ -412,4 +414,44 @@ TEST_F(Evaluate, test_simplify_refer_to_var)
     EXPECT_EQ(e->toString(), "sqrt(2 + Var)");
     EXPECT_EQ(simplified->toString(), "sqrt(2 + Var)");
 }
+
+TEST_F(Evaluate, test_program_matches_tree)
+{
+    auto* var = freecad_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Var"));
+    var->setValue(2.5);
+    auto* len = freecad_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "Len"));
+    len->setValue(10.0);
+    auto* count = freecad_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "Count"));
+    count->setValue(-7);
+
+    for (const char* expr : {"1 + 2", "7 / 2", "-7 % 3", "7.5 % -2", "2 ^ 10", "2 ^ -1",
+                             "Var * 2 + 1", "Count % 3", "Count * Var", "Len * 2 + 1 mm",
+                             "Len / 2 mm", "Len % 3", "Len > 5 mm ? Len : 5 mm",
+                             "Count < 0 ? -Count : Count", "(Var >= 2.5) + (Count != -7)",
+                             "True + 1", "-Len", "Len ^ 2"}) {
+        std::unique_ptr<App::Expression> e(App::ExpressionParser::parse(this_obj(), expr));
+        auto program = App::ExpressionProgram::compile(std::shared_ptr<App::Expression>(e->copy()));
+        ASSERT_TRUE(program->isValid()) << expr;
+        App::any value;
+        ASSERT_TRUE(program->eval(value)) << expr;
+        App::any expected = e->getValueAsAny();
+        EXPECT_EQ(value.type(), expected.type()) << expr;
+        EXPECT_TRUE(App::isAnyEqual(value, expected)) << expr;
+    }
+}
+
+TEST_F(Evaluate, test_program_fallback)
+{
+    std::unique_ptr<App::Expression> e(App::ExpressionParser::parse(this_obj(), "sqrt(4) + 1"));
+    EXPECT_FALSE(App::ExpressionProgram::compile(std::shared_ptr<App::Expression>(e->copy()))->isValid());
+
+    // Valid programs, but the tree must be used to get the value or the error
+    App::any value;
+    for (const char* expr : {"1 / (1 - 1)", "Label2 * 2"}) {
+        e.reset(App::ExpressionParser::parse(this_obj(), expr));
+        auto program = App::ExpressionProgram::compile(std::shared_ptr<App::Expression>(e->copy()));
+        EXPECT_TRUE(program->isValid()) << expr;
+        EXPECT_FALSE(program->eval(value)) << expr;
+    }
+}
 // clang-format on
@@ -91,6 +91,48 @@ TEST_F(PropertyFloatTest, testWriteRead)
     EXPECT_DOUBLE_EQ(prop2.getValue(), value);
 }
 
+class PropertyIntegerListTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    }
+};
+
+TEST_F(PropertyIntegerListTest, testWriteReadBinary)
+{
+    std::vector<long> values(100);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<long>(i * i) - 1000;
+    }
+    App::PropertyIntegerList prop;
+    prop.setValues(values);
+    Base::StringWriter writer;
+    writer.setMode("BinaryLists");
+    prop.Save(writer);
+
+    std::string str = "<?xml version='1.0' encoding='utf-8'?>\n";
+    str.append("<Property name='List' type='App::PropertyIntegerList'>\n");
+    str.append(writer.getString());
+    str.append("</Property>\n");
+
+    Base::StringWriter fileWriter;
+    prop.SaveDocFile(fileWriter);
+
+    std::stringstream data(str);
+    Base::XMLReader reader("Document.xml", data);
+    App::PropertyIntegerList prop2;
+    prop2.Restore(reader);
+    EXPECT_TRUE(reader.isRegistered(&prop2));
+    EXPECT_EQ(prop2.getSize(), 0);
+
+    std::stringstream file(fileWriter.getString());
+    Base::Reader fileReader(file, "List", 1);
+    prop2.RestoreDocFile(fileReader);
+    EXPECT_EQ(prop2.getValues(), values);
+}
+
 std::string RenameProperty::_docName;
 App::Document* RenameProperty::_doc {nullptr};
 
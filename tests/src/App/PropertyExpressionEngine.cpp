@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -10,6 +12,7 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -92,4 +95,77 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+// Counts the evaluations of the wrapped expression. Its type is unknown to
+// ExpressionProgram, so every evaluation goes through _getPyValue().
+class CountingExpression: public App::Expression
+{
+public:
+    CountingExpression(App::DocumentObject* owner, App::ExpressionPtr inner, std::shared_ptr<int> count)
+        : Expression(owner), inner(std::move(inner)), count(std::move(count))
+    {}
+
+    App::Expression* simplify() const override
+    {
+        return _copy();
+    }
+
+protected:
+    App::Expression* _copy() const override
+    {
+        return new CountingExpression(getOwner(), App::ExpressionPtr(inner->copy()), count);
+    }
+    void _toString(std::ostream& ss, bool persistent, int indent) const override
+    {
+        inner->toString(ss, persistent, false, indent);
+    }
+    void _getIdentifiers(std::map<App::ObjectIdentifier, bool>& deps) const override
+    {
+        inner->getIdentifiers(deps);
+    }
+    Py::Object _getPyValue() const override
+    {
+        ++*count;
+        return inner->getPyValue();
+    }
+
+private:
+    App::ExpressionPtr inner;
+    std::shared_ptr<int> count;
+};
+
+TEST_F(PropertyExpressionEngineTest, executeSkipsUnchangedInputs)
+{
+    auto source = dynamic_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "Source"));
+    auto target = dynamic_cast<App::PropertyLength*>(target_prop());
+    source->setValue(10.0);
+
+    auto count = std::make_shared<int>(0);
+    auto target_path = App::ObjectIdentifier::parse(this_obj(), target_name());
+    std::shared_ptr<App::Expression> target_rule(new CountingExpression(
+        this_obj(), App::ExpressionPtr(App::Expression::parse(this_obj(), "Source * 2")), count));
+    this_obj()->setExpression(target_path, target_rule);
+
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(target->getValue(), 20.0);
+
+    // Nothing changed, the binding is not evaluated again
+    int evaluations = *count;
+    EXPECT_GT(evaluations, 0);
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_EQ(*count, evaluations);
+    EXPECT_DOUBLE_EQ(target->getValue(), 20.0);
+
+    // A change of the bound property is overridden
+    target->setValue(5.0);
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_EQ(*count, evaluations + 1);
+    EXPECT_DOUBLE_EQ(target->getValue(), 20.0);
+
+    // A change of an input is picked up
+    source->setValue(3.0);
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_EQ(*count, evaluations + 2);
+    EXPECT_DOUBLE_EQ(target->getValue(), 6.0);
+}
+
 // clang-format on
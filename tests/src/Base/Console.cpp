@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Base/Console.h>
+
+class RecordingLogger: public Base::ILogger
+{
+public:
+    void sendLog(
+        const std::string& notifiername,
+        const std::string& msg,
+        Base::LogStyle level,
+        Base::IntendedRecipient recipient,
+        Base::ContentType content
+    ) override
+    {
+        (void)notifiername;
+        (void)level;
+        (void)recipient;
+        (void)content;
+        messages.push_back(msg);
+    }
+    const char* name() override
+    {
+        return "RecordingLogger";
+    }
+
+    std::vector<std::string> messages;
+};
+
+class ConsoleTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Base::Console().attachObserver(&logger);
+    }
+
+    void TearDown() override
+    {
+        Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+        Base::Console().detachObserver(&logger);
+    }
+
+    RecordingLogger& getLogger()
+    {
+        return logger;
+    }
+
+private:
+    RecordingLogger logger;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(ConsoleTest, asyncModeDefersUntilFlush)
+{
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Async);
+    for (int i = 0; i < 3; ++i) {
+        Base::Console().log("Message %d\n", i);
+    }
+    EXPECT_TRUE(getLogger().messages.empty());
+
+    Base::Console().flush();
+    ASSERT_EQ(getLogger().messages.size(), 3);
+    EXPECT_EQ(getLogger().messages[0], "Message 0\n");
+    EXPECT_EQ(getLogger().messages[2], "Message 2\n");
+}
+
+TEST_F(ConsoleTest, asyncModeKeepsAllMessagesInOrder)
+{
+    // More messages than the ring buffer holds, so that senders also have to
+    // drain it
+    const int threadCount = 4;
+    const int messageCount = 3000;
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Async);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < messageCount; ++i) {
+                Base::Console().log("%d %d", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Base::Console().flush();
+
+    ASSERT_EQ(getLogger().messages.size(), threadCount * messageCount);
+    std::vector<int> next(threadCount, 0);
+    for (const auto& msg : getLogger().messages) {
+        int t = std::stoi(msg);
+        int i = std::stoi(msg.substr(msg.find(' ') + 1));
+        EXPECT_EQ(i, next[t]);
+        next[t] = i + 1;
+    }
+}
+
+TEST_F(ConsoleTest, inactiveCategoryIsNotDelivered)
+{
+    getLogger().bLog = false;
+    Base::Console().log("Hidden\n");
+    Base::Console().message("Shown\n");
+    ASSERT_EQ(getLogger().messages.size(), 1);
+    EXPECT_EQ(getLogger().messages[0], "Shown\n");
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -443,6 +443,65 @@ TEST_F(ParameterTest, TestObserverNoRef)
     EXPECT_EQ(obs.getCountNotifications(), 1);
 }
 
+TEST_F(ParameterTest, TestValuesAfterLoadAndRemove)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup/Sub1");
+    grp->SetBool("Bool", true);
+    grp->SetInt("Int", -3);
+    grp->SetUnsigned("UInt", 4);
+    grp->SetFloat("Float", 1.5);
+    grp->SetASCII("String", "Text");
+    grp->SetInt("Shared", 1);
+    grp->SetFloat("Shared", 2.0);
+
+    std::string fn = getFileName();
+    cfg->exportTo(fn.c_str());
+
+    auto mgr = ParameterManager::Create();
+    ASSERT_EQ(mgr->LoadDocument(fn.c_str()), 1);
+    auto grp2 = mgr->GetGroup("TopLevelGroup/Sub1");
+    EXPECT_EQ(grp2->GetBool("Bool", false), true);
+    EXPECT_EQ(grp2->GetInt("Int", 0), -3);
+    EXPECT_EQ(grp2->GetUnsigned("UInt", 0), 4);
+    EXPECT_DOUBLE_EQ(grp2->GetFloat("Float", 0.0), 1.5);
+    EXPECT_EQ(grp2->GetASCII("String", ""), "Text");
+    EXPECT_EQ(grp2->GetInt("Shared", 0), 1);
+    EXPECT_DOUBLE_EQ(grp2->GetFloat("Shared", 0.0), 2.0);
+
+    grp2->RemoveInt("Shared");
+    EXPECT_EQ(grp2->GetInt("Shared", 0), 0);
+    EXPECT_DOUBLE_EQ(grp2->GetFloat("Shared", 0.0), 2.0);
+
+    grp2->Clear();
+    EXPECT_EQ(grp2->GetBool("Bool", false), false);
+    EXPECT_EQ(grp2->GetASCII("String", "Preset"), "Preset");
+    EXPECT_DOUBLE_EQ(grp2->GetFloat("Shared", 0.0), 0.0);
+}
+
+TEST_F(ParameterTest, TestObserverReadsNewValue)
+{
+    class ReadingObserver: public ParameterGrp::ObserverType
+    {
+    public:
+        void OnChange(ParameterGrp::SubjectType& rCaller, ParameterGrp::MessageType Reason) override
+        {
+            value = static_cast<ParameterGrp&>(rCaller).GetInt(Reason, -1);
+        }
+        long value = 0;
+    };
+
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    ReadingObserver obs;
+    grp->Attach(&obs);
+    grp->SetInt("Int", 5);
+    EXPECT_EQ(obs.value, 5);
+    grp->RemoveInt("Int");
+    EXPECT_EQ(obs.value, -1);
+    grp->Detach(&obs);
+}
+
 TEST_F(ParameterTest, TestLockFile)
 {
     std::string fn = getFileName();
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <Base/Type.h>
+
+#include <src/App/InitApplication.h>
+
+class Type: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        root = Base::Type::createType(Base::Type::BadType, "TypeTest::Root");
+        left = Base::Type::createType(root, "TypeTest::Left");
+        right = Base::Type::createType(root, "TypeTest::Right");
+        leaf = Base::Type::createType(left, "TypeTest::Leaf");
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+    static Base::Type root;
+    static Base::Type left;
+    static Base::Type right;
+    static Base::Type leaf;
+    // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+};
+
+Base::Type Type::root;
+Base::Type Type::left;
+Base::Type Type::right;
+Base::Type Type::leaf;
+
+TEST_F(Type, TestFromName)
+{
+    EXPECT_EQ(Base::Type::fromName("TypeTest::Leaf"), leaf);
+    EXPECT_TRUE(Base::Type::fromName("TypeTest::Unknown").isBad());
+    EXPECT_TRUE(Base::Type::fromName(nullptr).isBad());
+}
+
+TEST_F(Type, TestIsDerivedFrom)
+{
+    EXPECT_TRUE(leaf.isDerivedFrom(leaf));
+    EXPECT_TRUE(leaf.isDerivedFrom(left));
+    EXPECT_TRUE(leaf.isDerivedFrom(root));
+    EXPECT_FALSE(leaf.isDerivedFrom(right));
+    EXPECT_FALSE(root.isDerivedFrom(leaf));
+    EXPECT_FALSE(right.isDerivedFrom(left));
+}
+
+TEST_F(Type, TestBadType)
+{
+    EXPECT_FALSE(root.isDerivedFrom(Base::Type::BadType));
+    EXPECT_FALSE(Base::Type::BadType.isDerivedFrom(root));
+    EXPECT_TRUE(Base::Type::BadType.isDerivedFrom(Base::Type::BadType));
+}
+
+TEST_F(Type, TestGetAllDerivedFrom)
+{
+    std::vector<Base::Type> types;
+    EXPECT_EQ(Base::Type::getAllDerivedFrom(left, types), 2);
+    EXPECT_EQ(types, (std::vector<Base::Type> {left, leaf}));
+}
@@ -20,6 +20,7 @@
  ***************************************************************************/
 #include <gtest/gtest.h>
 #include <string>
+#include <vector>
 #include <Base/UniqueNameManager.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -122,4 +123,29 @@ TEST(UniqueNameManager, UniqueNameWith9NDigits)
     manager.addExactName("Compound123456789");
     EXPECT_EQ(manager.makeUniqueName("Compound", 3), "Compound123456790");
 }
+TEST(UniqueNameManager, MakeUniqueNamesForNewBaseName)
+{
+    // Check that the first of several names for an unused base name is the base name
+    Base::UniqueNameManager manager;
+    auto names = manager.makeUniqueNames("Body", 3, 3);
+    EXPECT_EQ(names, (std::vector<std::string> {"Body", "Body001", "Body002"}));
+    EXPECT_FALSE(manager.containsName("Body"));
+}
+TEST(UniqueNameManager, MakeUniqueNamesMatchesMakeUniqueName)
+{
+    // Check that generating names in bulk gives the same names as generating and adding them one
+    // at a time, including when the digits outgrow the digit count
+    Base::UniqueNameManager bulk;
+    Base::UniqueNameManager single;
+    bulk.addExactName("Box997");
+    single.addExactName("Box997");
+    auto names = bulk.makeUniqueNames("Box", 5, 3);
+    ASSERT_EQ(names.size(), 5);
+    for (auto& name : names) {
+        auto expected = single.makeUniqueName("Box", 3);
+        single.addExactName(expected);
+        EXPECT_EQ(name, expected);
+    }
+    EXPECT_EQ(names.back(), "Box1002");
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,7 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <zipios++/zipinputstream.h>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +138,67 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+class DataFile: public Base::Persistence
+{
+public:
+    explicit DataFile(std::string data)
+        : data(std::move(data))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+
+    std::string data;
+};
+
+TEST(ZipWriterTest, writeFilesInParallel)
+{
+    // Arrange
+    std::mt19937 gen(42);
+    std::string noise(100000, '\0');
+    for (auto& ch : noise) {
+        ch = static_cast<char>(gen());
+    }
+    std::vector<DataFile> files {
+        DataFile(std::string(100000, 'a')),
+        DataFile(noise),
+        DataFile(std::string()),
+        DataFile("text")
+    };
+    std::stringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setThreads(3);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (const auto& file : files) {
+            writer.addFile("File", &file);
+        }
+        writer.writeFiles();
+    }
+
+    // Assert
+    archive.seekg(0);
+    zipios::ZipInputStream zip(archive);
+    std::ostringstream document;
+    document << zip.rdbuf();
+    EXPECT_EQ(document.str(), "<Document/>");
+    for (const auto& file : files) {
+        auto entry = zip.getNextEntry();
+        ASSERT_TRUE(entry->isValid());
+        std::string content {std::istreambuf_iterator<char>(zip), std::istreambuf_iterator<char>()};
+        EXPECT_EQ(content, file.data);
+    }
+}
@@ -1,7 +1,15 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
 #include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <App/AutoTransaction.h>
+#include <App/Document.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Core/Elements.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 
 class MeshFeatureTest: public ::testing::Test
@@ -12,6 +20,22 @@ protected:
         tests::initApplication();
     }
 
+    static Mesh::MeshObject makeStrip(float z)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < 50000; ++i) {
+            auto x = static_cast<float>(i);
+            facets.emplace_back(
+                Base::Vector3f(x, 0, z),
+                Base::Vector3f(x + 1, 0, z),
+                Base::Vector3f(x, 1, z)
+            );
+        }
+        Mesh::MeshObject mesh;
+        mesh.addFacets(facets);
+        return mesh;
+    }
+
     void SetUp() override
     {}
 
@@ -39,4 +63,65 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+
+TEST_F(MeshFeatureTest, undoSpilledTransaction)
+{
+    // Arrange
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    doc->setUndoMode(1);
+    doc->setUndoLimit(1);
+    auto feature = doc->addObject<Mesh::Feature>("Mesh");
+
+    // Act
+    for (float z : {1.0F, 2.0F, 3.0F}) {
+        App::AutoTransaction transaction("Set mesh");
+        feature->Mesh.setValue(makeStrip(z));
+    }
+    unsigned int meshSize = feature->Mesh.getMemSize();
+    unsigned int undoSize = doc->getUndoMemSize();
+    doc->undo();
+    doc->undo();
+
+    // Assert
+    EXPECT_LT(undoSize, 2 * meshSize);
+    EXPECT_FLOAT_EQ(feature->Mesh.getValue().getKernel().GetBoundBox().MinZ, 1.0F);
+
+    App::GetApplication().closeDocument(docName.c_str());
+}
+
+TEST_F(MeshFeatureTest, undoUnreadableSpilledTransactionFails)
+{
+    // Arrange
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    doc->setUndoMode(1);
+    doc->setUndoLimit(1);
+    auto feature = doc->addObject<Mesh::Feature>("Mesh");
+    for (float z : {1.0F, 2.0F, 3.0F}) {
+        App::AutoTransaction transaction("Set mesh");
+        feature->Mesh.setValue(makeStrip(z));
+    }
+    std::vector<std::filesystem::path> spillFiles;
+    auto dir = Base::FileInfo::stringToPath(doc->TransientDir.getStrValue());
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.path().filename().string().rfind("Undo", 0) == 0) {
+            spillFiles.push_back(entry.path());
+            std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "garbage";
+        }
+    }
+    ASSERT_FALSE(spillFiles.empty());
+    doc->undo();
+    int undos = doc->getAvailableUndos();
+
+    // Act / Assert
+    EXPECT_THROW(doc->undo(), Base::FileException);
+    EXPECT_EQ(doc->getAvailableUndos(), undos);
+    EXPECT_FLOAT_EQ(feature->Mesh.getValue().getKernel().GetBoundBox().MinZ, 2.0F);
+    for (const auto& file : spillFiles) {
+        EXPECT_TRUE(std::filesystem::exists(file));
+    }
+
+    App::GetApplication().closeDocument(docName.c_str());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
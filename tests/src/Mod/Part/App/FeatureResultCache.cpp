@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "Mod/Part/App/FeaturePartCut.h"
+#include "Mod/Part/App/FeatureResultCache.h"
+#include <src/App/InitApplication.h>
+
+#include "PartTestHelpers.h"
+
+class FeatureResultCacheTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        createTestDoc();
+        _cut = _doc->addObject<Part::Cut>();
+        _cut->Base.setValue(_boxes[0]);
+        _budget = Part::FeatureResultCache::instance().getBudget();
+        Part::FeatureResultCache::instance().setBudget(64 << 20);
+    }
+
+    void TearDown() override
+    {
+        Part::FeatureResultCache::instance().clear();
+        Part::FeatureResultCache::instance().setBudget(_budget);
+    }
+
+    Part::Cut* _cut = nullptr;  // NOLINT Can't be private in a test framework
+
+private:
+    std::size_t _budget {0};
+};
+
+TEST_F(FeatureResultCacheTest, restoresResultForSameInputs)
+{
+    // Arrange
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape first = _cut->Shape.getShape().getShape();
+
+    // Act
+    _cut->Tool.setValue(_boxes[2]);
+    _doc->recompute();
+    TopoDS_Shape second = _cut->Shape.getShape().getShape();
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape third = _cut->Shape.getShape().getShape();
+
+    // Assert
+    EXPECT_FALSE(second.IsPartner(first));
+    EXPECT_TRUE(third.IsPartner(first));
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(third), 3.0);
+}
+
+TEST_F(FeatureResultCacheTest, missesWhenUpstreamShapeChanges)
+{
+    // Arrange
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape first = _cut->Shape.getShape().getShape();
+
+    // Act
+    _boxes[1]->Height.setValue(4);
+    _doc->recompute();
+    TopoDS_Shape second = _cut->Shape.getShape().getShape();
+
+    // Assert
+    EXPECT_FALSE(second.IsPartner(first));
+}
+
+TEST_F(FeatureResultCacheTest, missesWhenUpstreamMaterialChanges)
+{
+    // Arrange
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    _cut->Tool.setValue(_boxes[2]);
+    _doc->recompute();
+    Materials::Material material;
+    material.setUUID(QStringLiteral("c4e5b0f6-3a42-4b8e-9d0a-6f2e1b7c8d90"));
+    _boxes[0]->ShapeMaterial.setValue(material);
+    // Keep the upstream shape, only the material differs
+    _boxes[0]->purgeTouched();
+
+    // Act
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(_cut->ShapeMaterial.getValue().getUUID(), material.getUUID());
+}
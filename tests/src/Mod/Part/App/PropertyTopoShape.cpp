@@ -2,12 +2,22 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+#include <sstream>
+
 #include <BRepFilletAPI_MakeFillet.hxx>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
 #include "PartTestHelpers.h"
 #include "Mod/Part/App/TopoShapeCompoundPy.h"
+#include "Mod/Part/App/ShapeFileCache.h"
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Parameter.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 
 using namespace Part;
 using namespace PartTestHelpers;
@@ -269,3 +279,226 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testRestoreDocFileAsync)
+{
+    // Arrange
+    Base::StringWriter writer;
+    _common->Shape.SaveDocFile(writer);
+    std::istringstream str(writer.getString());
+    Base::Reader reader(str, "Common.Shape.brp", 1);
+    Part::PropertyPartShape prop;
+
+    // Act
+    ASSERT_TRUE(prop.canRestoreDocFileAsync());
+    auto apply = std::async(std::launch::async, [&]() {
+                     return prop.restoreDocFileAsync(reader);
+                 }).get();
+    bool emptyBeforeApply = prop.getShape().isNull();
+    apply();
+
+    // Assert
+    EXPECT_TRUE(emptyBeforeApply);
+    EXPECT_FALSE(prop.getShape().isNull());
+    EXPECT_EQ(
+        prop.getShape().countSubShapes(TopAbs_FACE),
+        _common->Shape.getShape().countSubShapes(TopAbs_FACE)
+    );
+}
+
+TEST_F(PropertyTopoShapeTest, testRestoreDocFileDeferred)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    hGrp->SetBool("LazyLoadShapes", true);
+    Base::StringWriter writer;
+    _common->Shape.SaveDocFile(writer);
+    std::istringstream str(writer.getString());
+    Base::Reader reader(str, "Common.Shape.brp", 1);
+    Part::PropertyPartShape prop;
+
+    // Act
+    prop.RestoreDocFile(reader);
+    hGrp->RemoveBool("LazyLoadShapes");
+    bool deferred = prop.isShapeDeferred();
+    int faces = prop.getShape().countSubShapes(TopAbs_FACE);
+
+    // Assert
+    EXPECT_TRUE(deferred);
+    EXPECT_FALSE(prop.isShapeDeferred());
+    EXPECT_EQ(faces, _common->Shape.getShape().countSubShapes(TopAbs_FACE));
+}
+
+TEST_F(PropertyTopoShapeTest, testSaveDocFileDeferred)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    hGrp->SetBool("LazyLoadShapes", true);
+    Base::StringWriter writer;
+    _common->Shape.SaveDocFile(writer);
+    std::istringstream str(writer.getString());
+    Base::Reader reader(str, "Common.Shape.brp", 1);
+    Part::PropertyPartShape prop;
+    prop.RestoreDocFile(reader);
+    hGrp->RemoveBool("LazyLoadShapes");
+
+    // Act
+    Base::StringWriter saved;
+    prop.SaveDocFile(saved);
+
+    // Assert
+    EXPECT_TRUE(prop.isShapeDeferred());
+    EXPECT_EQ(saved.getString(), writer.getString());
+}
+
+TEST_F(PropertyTopoShapeTest, testCopySharesShape)
+{
+    // Act
+    std::unique_ptr<App::Property> copy(_common->Shape.Copy());
+
+    // Assert
+    EXPECT_TRUE(static_cast<PropertyPartShape*>(copy.get())->getValue().IsPartner(
+        _common->Shape.getValue()
+    ));
+    EXPECT_FALSE(_common->Shape.isCopyOwningData());
+}
+
+class PropertyTopoShapeFileCacheTest: public PropertyTopoShapeTest
+{
+protected:
+    void SetUp() override
+    {
+        PropertyTopoShapeTest::SetUp();
+        _budget = ShapeFileCache::instance().getBudget();
+        ShapeFileCache::instance().setBudget(64 << 20);
+        ShapeFileCache::instance().clear();
+        _fileName = Base::FileInfo::getTempPath() + _docName + ".FCStd";
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        ShapeFileCache::instance().clear();
+        ShapeFileCache::instance().setBudget(_budget);
+        for (auto doc : App::GetApplication().getDocuments()) {
+            if (doc->FileName.getStrValue() == _fileName) {
+                App::GetApplication().closeDocument(doc->getName());
+            }
+        }
+        Base::FileInfo(_fileName).deleteFile();
+    }
+
+    /// Save the test document, close it and open it again
+    Common* saveAndReopen()
+    {
+        std::string name = _common->getNameInDocument();
+        _doc->saveAs(_fileName.c_str());
+        App::GetApplication().closeDocument(_docName.c_str());
+        auto doc = App::GetApplication().openDocument(_fileName.c_str());
+        return doc ? freecad_cast<Common*>(doc->getObject(name.c_str())) : nullptr;
+    }
+
+    std::string _fileName;  // NOLINT Can't be private in a test framework
+
+private:
+    std::size_t _budget {0};
+};
+
+TEST_F(PropertyTopoShapeFileCacheTest, reopenSharesSavedShape)
+{
+    // Arrange
+    TopoDS_Shape saved = _common->Shape.getValue();
+    auto elementMapSize = _common->Shape.getShape().getElementMapSize();
+    auto version = _common->Shape.getElementMapVersion(false);
+    auto hits = ShapeFileCache::instance().getStatistics().hits;
+
+    // Act
+    auto common = saveAndReopen();
+
+    // Assert
+    ASSERT_NE(common, nullptr);
+    EXPECT_TRUE(common->Shape.getValue().IsPartner(saved));
+    EXPECT_GT(ShapeFileCache::instance().getStatistics().hits, hits);
+    EXPECT_EQ(common->Shape.getShape().getElementMapSize(), elementMapSize);
+    EXPECT_EQ(common->Shape.getElementMapVersion(true), version);
+}
+
+TEST_F(PropertyTopoShapeFileCacheTest, revertSharesSavedShape)
+{
+    // Arrange
+    _doc->saveAs(_fileName.c_str());
+    TopoDS_Shape saved = _common->Shape.getValue();
+    auto elementMapSize = _common->Shape.getShape().getElementMapSize();
+    _common->Tool.setValue(_boxes[3]);
+    _doc->recompute();
+    ASSERT_FALSE(_common->Shape.getValue().IsPartner(saved));
+
+    // Act
+    _doc->restore();
+    auto common = freecad_cast<Common*>(_doc->getObject(_common->getNameInDocument()));
+
+    // Assert
+    ASSERT_NE(common, nullptr);
+    EXPECT_TRUE(common->Shape.getValue().IsPartner(saved));
+    EXPECT_EQ(common->Shape.getShape().getElementMapSize(), elementMapSize);
+}
+
+TEST_F(PropertyTopoShapeFileCacheTest, reopenWithLazyLoadingTakesCachedShape)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    hGrp->SetBool("LazyLoadShapes", true);
+    TopoDS_Shape saved = _common->Shape.getValue();
+
+    // Act
+    auto common = saveAndReopen();
+    hGrp->RemoveBool("LazyLoadShapes");
+
+    // Assert
+    ASSERT_NE(common, nullptr);
+    EXPECT_FALSE(common->Shape.isShapeDeferred());
+    EXPECT_TRUE(common->Shape.getValue().IsPartner(saved));
+}
+
+TEST_F(PropertyTopoShapeFileCacheTest, resaveReplacesCachedShape)
+{
+    // Arrange
+    _doc->saveAs(_fileName.c_str());
+    TopoDS_Shape saved = _common->Shape.getValue();
+    _common->Tool.setValue(_boxes[3]);
+    _doc->recompute();
+    TopoDS_Shape changed = _common->Shape.getValue();
+    _doc->save();
+
+    // Act
+    auto common = saveAndReopen();
+
+    // Assert
+    ASSERT_NE(common, nullptr);
+    EXPECT_FALSE(common->Shape.getValue().IsPartner(saved));
+    EXPECT_TRUE(common->Shape.getValue().IsPartner(changed));
+}
+
+TEST_F(PropertyTopoShapeFileCacheTest, reopenUnderOtherPathSharesSavedShape)
+{
+    // Arrange
+    std::string name = _common->getNameInDocument();
+    TopoDS_Shape saved = _common->Shape.getValue();
+    std::string otherPath = Base::FileInfo::getTempPath() + "./" + _docName + ".FCStd";
+    _doc->saveAs(otherPath.c_str());
+    App::GetApplication().closeDocument(_docName.c_str());
+
+    // Act
+    auto doc = App::GetApplication().openDocument(_fileName.c_str());
+    auto common = doc ? freecad_cast<Common*>(doc->getObject(name.c_str())) : nullptr;
+
+    // Assert
+    ASSERT_NE(common, nullptr);
+    EXPECT_TRUE(common->Shape.getValue().IsPartner(saved));
+}
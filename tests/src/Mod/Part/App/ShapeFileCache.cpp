@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+
+#include "Mod/Part/App/ShapeFileCache.h"
+#include "Mod/Part/App/TopoShape.h"
+#include <Base/FileInfo.h>
+#include <src/App/InitApplication.h>
+
+class ShapeFileCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _budget = Part::ShapeFileCache::instance().getBudget();
+        Part::ShapeFileCache::instance().setBudget(64 << 20);
+        Part::ShapeFileCache::instance().clear();
+        _archive = Base::FileInfo::getTempFileName("ShapeFileCacheTest") + ".FCStd";
+        writeArchive("content");
+    }
+
+    void TearDown() override
+    {
+        Part::ShapeFileCache::instance().clear();
+        Part::ShapeFileCache::instance().setBudget(_budget);
+        Base::FileInfo(_archive).deleteFile();
+    }
+
+    void writeArchive(const std::string& content) const
+    {
+        std::ofstream stream(Base::FileInfo::stringToPath(_archive), std::ios::binary);
+        stream << content;
+    }
+
+    std::string _archive;  // NOLINT Can't be private in a test framework
+
+private:
+    std::size_t _budget {0};
+};
+
+TEST_F(ShapeFileCacheTest, sharesShapeOfSameFile)
+{
+    // Arrange
+    auto& cache = Part::ShapeFileCache::instance();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    cache.store(_archive, "PartShape.bin", box);
+
+    // Act
+    TopoDS_Shape found;
+    bool hit = cache.find(_archive, "PartShape.bin", found);
+    TopoDS_Shape other;
+    bool otherFile = cache.find(_archive, "PartShape1.bin", other);
+
+    // Assert
+    EXPECT_TRUE(hit);
+    EXPECT_TRUE(found.IsSame(box));
+    EXPECT_FALSE(otherFile);
+    EXPECT_EQ(cache.getStatistics().hits, 1);
+    EXPECT_EQ(cache.getStatistics().misses, 1);
+}
+
+TEST_F(ShapeFileCacheTest, ignoresChangedFile)
+{
+    // Arrange
+    auto& cache = Part::ShapeFileCache::instance();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    cache.store(_archive, "PartShape.bin", box);
+
+    // Act
+    writeArchive("changed content");
+    TopoDS_Shape found;
+    bool hit = cache.find(_archive, "PartShape.bin", found);
+
+    // Assert
+    EXPECT_FALSE(hit);
+}
+
+TEST_F(ShapeFileCacheTest, ignoresFilesOtherThanDocuments)
+{
+    // Arrange
+    auto& cache = Part::ShapeFileCache::instance();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    std::string archive = _archive.substr(0, _archive.size() - 6);
+
+    // Act
+    cache.store(archive, "PartShape.bin", box);
+    TopoDS_Shape found;
+    bool hit = cache.find(archive, "PartShape.bin", found);
+
+    // Assert
+    EXPECT_FALSE(hit);
+}
+
+TEST_F(ShapeFileCacheTest, evictsLeastRecentlyUsed)
+{
+    // Arrange
+    auto& cache = Part::ShapeFileCache::instance();
+    TopoDS_Shape box1 = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    TopoDS_Shape box2 = BRepPrimAPI_MakeBox(2.0, 2.0, 2.0).Shape();
+    TopoDS_Shape box3 = BRepPrimAPI_MakeBox(3.0, 3.0, 3.0).Shape();
+    std::size_t size = Part::TopoShape(box1).getMemSize();
+    cache.setBudget(2 * size + size / 2);
+    TopoDS_Shape found;
+
+    // Act
+    cache.store(_archive, "1", box1);
+    cache.store(_archive, "2", box2);
+    cache.find(_archive, "1", found);
+    cache.store(_archive, "3", box3);
+
+    // Assert
+    EXPECT_TRUE(cache.find(_archive, "1", found));
+    EXPECT_FALSE(cache.find(_archive, "2", found));
+    EXPECT_TRUE(cache.find(_archive, "3", found));
+}
+
+TEST_F(ShapeFileCacheTest, disabledCacheStoresNothing)
+{
+    // Arrange
+    auto& cache = Part::ShapeFileCache::instance();
+    cache.setBudget(0);
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    TopoDS_Shape found;
+
+    // Act
+    cache.store(_archive, "box", box);
+
+    // Assert
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_FALSE(cache.find(_archive, "box", found));
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Circ.hxx>
+
+#include "Mod/Part/App/TessellationCache.h"
+#include <src/App/InitApplication.h>
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _budget = Part::TessellationCache::instance().getBudget();
+        Part::TessellationCache::instance().setBudget(64 << 20);
+        Part::TessellationCache::instance().clear();
+    }
+
+    void TearDown() override
+    {
+        Part::TessellationCache::instance().clear();
+        Part::TessellationCache::instance().setBudget(_budget);
+    }
+
+private:
+    std::size_t _budget {0};
+};
+
+TEST_F(TessellationCacheTest, meshesOnlyNewFaces)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    TopoDS_Shape box1 = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    TopoDS_Shape box2 = BRepPrimAPI_MakeBox(gp_Pnt(5.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape();
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    builder.Add(comp, box1);
+    builder.Add(comp, box2);
+
+    // Act
+    int first = cache.mesh(box1, 0.1, 0.5);
+    int second = cache.mesh(box1, 0.1, 0.5);
+    int third = cache.mesh(comp, 0.1, 0.5);
+
+    // Assert
+    EXPECT_EQ(first, 6);
+    EXPECT_EQ(second, 0);
+    EXPECT_EQ(third, 6);
+    for (TopExp_Explorer xp(comp, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        EXPECT_FALSE(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull());
+    }
+}
+
+TEST_F(TessellationCacheTest, restoresTriangulationOfOtherParameters)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    cache.mesh(box, 0.1, 0.5);
+    TopExp_Explorer xp(box, TopAbs_FACE);
+    TopLoc_Location loc;
+    Handle(Poly_Triangulation) coarse = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+
+    // Act
+    int fine = cache.mesh(box, 0.01, 0.1);
+    int restored = cache.mesh(box, 0.1, 0.5);
+
+    // Assert
+    EXPECT_EQ(fine, 6);
+    EXPECT_EQ(restored, 0);
+    EXPECT_EQ(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc), coarse);
+}
+
+TEST_F(TessellationCacheTest, disabledCacheMeshesAllFaces)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    cache.setBudget(0);
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    // Act
+    cache.mesh(box, 0.1, 0.5);
+    int second = cache.mesh(box, 0.1, 0.5);
+
+    // Assert
+    EXPECT_EQ(second, 6);
+}
+
+TEST_F(TessellationCacheTest, meshesFreeEdgesWithGivenDeflection)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(gp_Circ(gp_Ax2(), 10.0)).Edge();
+    auto nodeCount = [&edge]() {
+        TopLoc_Location loc;
+        Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, loc);
+        return polygon.IsNull() ? 0 : polygon->NbNodes();
+    };
+
+    // Act
+    int first = cache.mesh(edge, 1.0, 0.5);
+    int coarse = nodeCount();
+    cache.mesh(edge, 0.01, 0.1);
+    int fine = nodeCount();
+    int restored = cache.mesh(edge, 1.0, 0.5);
+
+    // Assert
+    EXPECT_EQ(first, 1);
+    EXPECT_GT(coarse, 0);
+    EXPECT_GT(fine, coarse);
+    EXPECT_EQ(restored, 0);
+    EXPECT_EQ(nodeCount(), coarse);
+}
+
+TEST_F(TessellationCacheTest, meshesSharedFacesOnce)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    int first = 0;
+    int second = 0;
+
+    // Act
+    std::thread thread([&]() { first = cache.mesh(box, 0.1, 0.5); });
+    second = cache.mesh(box, 0.1, 0.5);
+    thread.join();
+
+    // Assert
+    EXPECT_EQ(first + second, 6);
+}
@@ -8,6 +8,7 @@
 #include <gp_Quaternion.hxx>
 #include <TopoDS_TVertex.hxx>
 #include <BRep_TVertex.hxx>
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
@@ -289,4 +290,27 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, SpatialIndexFindsIntersectingShapes)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    Part::TopoShapeCache cache(box);
+    auto& index = cache.getAncestry(TopAbs_FACE).getSpatialIndex();
+    Bnd_Box query;
+    query.Update(-0.1, 0.5, 0.5, 0.1, 1.5, 2.5);
+
+    // Act
+    auto found = index.find(query);
+    auto onPlane = index.find(gp_Pln(gp_Pnt(0.0, 0.0, 3.0), gp_Dir(0.0, 0.0, 1.0)));
+    auto outside = index.find(gp_Pln(gp_Pnt(0.0, 0.0, 5.0), gp_Dir(0.0, 0.0, 1.0)));
+
+    // Assert
+    ASSERT_EQ(found.size(), 1);
+    Bnd_Box faceBox;
+    BRepBndLib::Add(cache.findShape(box, TopAbs_FACE, found[0]), faceBox);
+    EXPECT_NEAR(faceBox.CornerMax().X(), 0.0, 1e-6);
+    EXPECT_EQ(onPlane.size(), 5);  // The top face and the four side faces
+    EXPECT_TRUE(outside.empty());
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
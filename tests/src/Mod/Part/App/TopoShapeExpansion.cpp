@@ -3361,4 +3361,66 @@ TEST_F(TopoShapeExpansionTest, makeElementOffset2D)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementBooleanManyToolsNamesMatchSerial)
+{
+    // Arrange, enough tools to collect the names on several threads
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    auto makeCut = []() {
+        std::vector<TopoShape> shapes;
+        shapes.emplace_back(BRepPrimAPI_MakeBox(100.0, 2.0, 2.0).Shape(), 1L);
+        for (int i = 0; i < 60; ++i) {
+            shapes.emplace_back(
+                BRepPrimAPI_MakeBox(gp_Pnt(1.0 + i * 1.5, -1.0, 1.0), 1.0, 4.0, 2.0).Shape(),
+                2L + i
+            );
+        }
+        TopoShape result;
+        result.makeElementBoolean(Part::OpCodes::Cut, shapes);
+        return result;
+    };
+
+    // Act
+    hGrp->SetBool("ParallelElementMap", false);
+    TopoShape serial = makeCut();
+    hGrp->RemoveBool("ParallelElementMap");
+    TopoShape parallel = makeCut();
+
+    // Assert
+    auto elements = elementMap(serial);
+    EXPECT_EQ(elementMap(parallel), elements);
+    int faceCount = static_cast<int>(parallel.countSubShapes(TopAbs_FACE));
+    for (int i = 1; i <= faceCount; ++i) {
+        EXPECT_EQ(elements.count(IndexedName("Face", i)), 1);
+    }
+}
+
+TEST_F(TopoShapeExpansionTest, findSubShapesNearPointOfLocatedShape)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    TopoShape shape(box.Moved(TopLoc_Location(move)));
+    TopoShape vertex(BRepBuilderAPI_MakeVertex(gp_Pnt(11.0, 1.0, 1.0)).Vertex());
+
+    // Act
+    auto near = shape.findSubShapesNearPoint(TopAbs_VERTEX, gp_Pnt(11.0, 1.0, 1.0));
+    auto far = shape.findSubShapesNearPoint(TopAbs_VERTEX, gp_Pnt(1.0, 1.0, 1.0));
+    auto faces = shape.findSubShapesNearPlane(
+        TopAbs_FACE,
+        gp_Pln(gp_Pnt(10.0, 0.0, 0.0), gp_Dir(1.0, 0.0, 0.0))
+    );
+    std::vector<std::string> names;
+    auto found = shape.findSubShapesWithSharedVertex(vertex, &names);
+
+    // Assert
+    ASSERT_EQ(near.size(), 1);
+    EXPECT_TRUE(far.empty());
+    EXPECT_EQ(faces.size(), 5);  // The face on the plane and its four neighbours
+    ASSERT_EQ(found.size(), 1);
+    EXPECT_EQ(names, std::vector<std::string> {"Vertex" + std::to_string(near[0])});
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)